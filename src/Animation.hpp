@@ -0,0 +1,235 @@
+/*
+    Batched pose blending and keyframe sampling for skeletal animation.
+
+    Pose holds per-bone local translation, rotation & scale arrays. The static batch functions
+    blend whole arrays and match the single-value math in Vector.hpp:
+
+        Pose::Lerp(Vector3D*)       -> Vector3Lerp
+        Pose::Lerp(Quaternion*)     -> QuaternionLerp
+        Pose::Nlerp                 -> QuaternionNlerp
+        Pose::Slerp                 -> QuaternionSlerp
+
+    Vector and quaternion lerps run over the arrays as flat floats through simd::Batch. Nlerp and
+    Slerp handle one quaternion per simd::Float4, and Slerp uses scalar trig for the angle.
+    Every function takes an optional ThreadPool that splits arrays larger than parallelGrain.
+
+    AnimationTrack stores a full Pose per keyframe (every bone shares the key times, like raylib's
+    ModelAnimation). Sample() binary-searches the key times once and then blends all bones of the
+    two surrounding keys in one batch.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_ANIMATION
+#define RAYLIB_PLUSPLUS_ANIMATION
+#include "./RaylibExtern.hpp"
+#include "./Vector.hpp"
+#include "./Simd.hpp"
+#include "./ThreadPool.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace raylib {
+    namespace cpp {
+        enum class RotationBlend { Lerp, Nlerp, Slerp };
+
+        class Pose {
+        private:
+            static_assert(sizeof(Vector3D) == 3 * sizeof(float), "Vector3D must be three packed floats.");
+            static_assert(sizeof(Quaternion) == 4 * sizeof(float), "Quaternion must be four packed floats.");
+
+            template<typename F>
+            static void Run(size_t count, ThreadPool* pool, F&& body) {
+                if (pool && count >= 2 * parallelGrain) pool->ParallelFor(count, parallelGrain, body);
+                else body(size_t(0), count);
+            }
+
+            static void LerpFloats(const float* a, const float* b, float amount, float* out, size_t count) {
+                simd::Batch(count, [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F va = simd::Load<F>(a + i);
+                    simd::Store(va + F(amount) * (simd::Load<F>(b + i) - va), out + i);
+                });
+            }
+
+            static simd::Float4 NormalizeQuaternion(simd::Float4 q) {
+                float length = sqrtf(q.Dot4(q));
+                if (length == 0.0f) length = 1.0f;
+                return q * simd::Float4(1.0f / length);
+            }
+
+        public:
+            // Elements per thread chunk in the batch functions.
+            static constexpr size_t parallelGrain = 4096;
+
+            std::vector<Vector3D> translations;
+            std::vector<Quaternion> rotations;
+            std::vector<Vector3D> scales;
+
+            Pose() {}
+            Pose(size_t boneCount) { Resize(boneCount); }
+
+            size_t Size() const { return rotations.size(); }
+
+            // New bones start at the identity transform.
+            void Resize(size_t boneCount) {
+                translations.resize(boneCount, Vector3D(0.0f, 0.0f, 0.0f));
+                rotations.resize(boneCount, Quaternion());
+                scales.resize(boneCount, Vector3D(1.0f, 1.0f, 1.0f));
+            }
+
+            // Local bone matrix, MatrixMultiply(MatrixMultiply(Scale, Rotation), Translate).
+            Matrix GetBoneMatrix(size_t bone) const {
+                Matrix m = rotations[bone].ToMatrix();
+                const Vector3D& s = scales[bone];
+                const Vector3D& t = translations[bone];
+                m.m0 *= s.x, m.m1 *= s.x, m.m2 *= s.x;
+                m.m4 *= s.y, m.m5 *= s.y, m.m6 *= s.y;
+                m.m8 *= s.z, m.m9 *= s.z, m.m10 *= s.z;
+                m.m12 = t.x, m.m13 = t.y, m.m14 = t.z;
+                return m;
+            }
+
+            static void Lerp(const Vector3D* a, const Vector3D* b, float amount, Vector3D* out, size_t count, ThreadPool* pool = nullptr) {
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    LerpFloats(&a[begin].x, &b[begin].x, amount, &out[begin].x, (end - begin) * 3);
+                });
+            }
+
+            static void Lerp(const Quaternion* a, const Quaternion* b, float amount, Quaternion* out, size_t count, ThreadPool* pool = nullptr) {
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    LerpFloats(&a[begin].x, &b[begin].x, amount, &out[begin].x, (end - begin) * 4);
+                });
+            }
+
+            static void Nlerp(const Quaternion* a, const Quaternion* b, float amount, Quaternion* out, size_t count, ThreadPool* pool = nullptr) {
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    simd::Float4 t(amount);
+                    for (size_t i = begin; i < end; i++) {
+                        simd::Float4 qa = simd::Float4::Load(&a[i].x), qb = simd::Float4::Load(&b[i].x);
+                        NormalizeQuaternion(qa + t * (qb - qa)).Store(&out[i].x);
+                    }
+                });
+            }
+
+            static void Slerp(const Quaternion* a, const Quaternion* b, float amount, Quaternion* out, size_t count, ThreadPool* pool = nullptr) {
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    simd::Float4 t(amount);
+                    for (size_t i = begin; i < end; i++) {
+                        simd::Float4 qa = simd::Float4::Load(&a[i].x), qb = simd::Float4::Load(&b[i].x);
+                        float cosHalfTheta = qa.Dot4(qb);
+
+                        if (cosHalfTheta < 0) {
+                            qb = -qb;
+                            cosHalfTheta = -cosHalfTheta;
+                        }
+
+                        simd::Float4 result;
+                        if (fabsf(cosHalfTheta) >= 1.0f) {
+                            result = qa;
+                        } else if (cosHalfTheta > 0.95f) {
+                            result = NormalizeQuaternion(qa + t * (qb - qa));
+                        } else {
+                            float halfTheta = acosf(cosHalfTheta);
+                            float sinHalfTheta = sqrtf(1.0f - cosHalfTheta * cosHalfTheta);
+
+                            if (fabsf(sinHalfTheta) < 0.001f) {
+                                result = qa * simd::Float4(0.5f) + qb * simd::Float4(0.5f);
+                            } else {
+                                float ratioA = sinf((1 - amount) * halfTheta) / sinHalfTheta;
+                                float ratioB = sinf(amount * halfTheta) / sinHalfTheta;
+                                result = qa * simd::Float4(ratioA) + qb * simd::Float4(ratioB);
+                            }
+                        }
+
+                        result.Store(&out[i].x);
+                    }
+                });
+            }
+
+            static void Blend(const Quaternion* a, const Quaternion* b, float amount, Quaternion* out, size_t count, RotationBlend mode, ThreadPool* pool = nullptr) {
+                switch (mode) {
+                    case RotationBlend::Lerp: Lerp(a, b, amount, out, count, pool); break;
+                    case RotationBlend::Nlerp: Nlerp(a, b, amount, out, count, pool); break;
+                    case RotationBlend::Slerp: Slerp(a, b, amount, out, count, pool); break;
+                }
+            }
+
+            // out = a blended towards b by amount. out may be a or b; all three must have the same bone count.
+            static void Blend(const Pose& a, const Pose& b, float amount, Pose& out, RotationBlend mode = RotationBlend::Nlerp, ThreadPool* pool = nullptr) {
+                size_t count = a.Size();
+                out.Resize(count);
+                Lerp(a.translations.data(), b.translations.data(), amount, out.translations.data(), count, pool);
+                Blend(a.rotations.data(), b.rotations.data(), amount, out.rotations.data(), count, mode, pool);
+                Lerp(a.scales.data(), b.scales.data(), amount, out.scales.data(), count, pool);
+            }
+
+            Pose& Blend(const Pose& target, float amount, RotationBlend mode = RotationBlend::Nlerp, ThreadPool* pool = nullptr) {
+                Blend(*this, target, amount, *this, mode, pool);
+                return (*this);
+            }
+        };
+
+        class AnimationTrack {
+        public:
+            std::vector<float> times;   // Ascending key times in seconds.
+            std::vector<Pose> keys;     // One pose per key time, all with the same bone count.
+            bool loop = true;
+
+            AnimationTrack() {}
+
+            // Copies a raylib ModelAnimation, placing frame i at i / frameRate seconds.
+            AnimationTrack(const ::ModelAnimation& animation, float frameRate) {
+                times.reserve(animation.frameCount), keys.reserve(animation.frameCount);
+                for (int frame = 0; frame < animation.frameCount; frame++) {
+                    Pose pose(animation.boneCount);
+                    for (int bone = 0; bone < animation.boneCount; bone++) {
+                        const ::Transform& transform = animation.framePoses[frame][bone];
+                        pose.translations[bone] = transform.translation;
+                        pose.rotations[bone] = transform.rotation;
+                        pose.scales[bone] = transform.scale;
+                    }
+                    times.push_back(frame / frameRate), keys.push_back(std::move(pose));
+                }
+            }
+
+            size_t KeyCount() const { return times.size(); }
+            size_t BoneCount() const { return keys.empty() ? 0 : keys[0].Size(); }
+            float Duration() const { return times.empty() ? 0.0f : times.back() - times.front(); }
+
+            // Inserts a key, keeping times sorted (a key at an existing time goes after it).
+            AnimationTrack& AddKey(float time, const Pose& pose) {
+                size_t at = std::upper_bound(times.begin(), times.end(), time) - times.begin();
+                times.insert(times.begin() + at, time);
+                keys.insert(keys.begin() + at, pose);
+                return (*this);
+            }
+
+            /*
+                Writes the pose at time into out. Time wraps when loop is set and clamps otherwise.
+                The key search runs once for the whole track; all bones then blend in one batch.
+            */
+            void Sample(float time, Pose& out, RotationBlend mode = RotationBlend::Nlerp, ThreadPool* pool = nullptr) const {
+                if (keys.empty()) return;
+
+                float start = times.front(), duration = Duration();
+                if (loop && duration > 0.0f) {
+                    time = fmodf(time - start, duration);
+                    if (time < 0.0f) time += duration;
+                    time += start;
+                }
+
+                size_t next = std::upper_bound(times.begin(), times.end(), time) - times.begin();
+                if (next == 0 || next == times.size()) {
+                    out = keys[next == 0 ? 0 : times.size() - 1];
+                    return;
+                }
+
+                size_t prev = next - 1;
+                float span = times[next] - times[prev];
+                float amount = span > 0.0f ? (time - times[prev]) / span : 0.0f;
+                Pose::Blend(keys[prev], keys[next], amount, out, mode, pool);
+            }
+        };
+    }
+}
+#endif
@@ -0,0 +1,208 @@
+/*
+    Streams textures in without stalling the render thread.
+
+    Load queues a decode (LoadImage by default) on a ThreadPool and returns a future for the texture.
+    Decoded images wait in a queue until Update, called once per frame on the render thread, uploads
+    as many as fit the budget: budget.bytes of pixel data and budget.milliseconds of upload time. The
+    time limit is predicted from the upload rate measured so far, so a frame stops before an upload
+    that would overrun it rather than after. At least one image is uploaded per Update, so an image
+    larger than the whole budget still goes through.
+
+        AsyncTextureLoader loader;
+        loader.budget.milliseconds = 2.0f;
+        std::shared_future<::Texture2D> sky = loader.Load("sky.png");
+        ...
+        loader.Update(); // each frame, between BeginDrawing / EndDrawing or before them
+        if (sky.wait_for(std::chrono::seconds(0)) == std::future_status::ready) skyTexture = Texture(sky.get());
+
+    The upload side is an UploadSink: upload turns an image into a texture (LoadTextureFromImage in
+    GpuSink) and release frees the image afterwards (UnloadImage). Supplying a different sink, and a
+    decode function to Load, runs the whole scheduler without a GPU or files.
+
+    A failed decode (an image with no data) resolves to a texture with id 0, as LoadTexture does; an
+    exception thrown by a decode function is passed on to the future. The loader must outlive the
+    Update calls; its destructor waits for running decodes and resolves anything still queued to id 0.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_ASYNC_TEXTURE_LOADER
+#define RAYLIB_PLUSPLUS_ASYNC_TEXTURE_LOADER
+#include "./RaylibExtern.hpp"
+#include "./PixelConvert.hpp"
+#include "./ThreadPool.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace raylib {
+    namespace cpp {
+        class AsyncTextureLoader {
+        public:
+            struct UploadSink {
+                std::function<::Texture2D(const ::Image&)> upload;
+                std::function<void(const ::Image&)> release;
+            };
+
+            struct Budget {
+                float milliseconds = 2.0f;
+                size_t bytes = size_t(16) << 20;
+            };
+
+            // Upload with LoadTextureFromImage, then UnloadImage. Needs the render thread's GL context.
+            static UploadSink GpuSink() {
+                return { [](const ::Image& image) { return ::LoadTextureFromImage(image); }, [](const ::Image& image) { ::UnloadImage(image); } };
+            }
+
+            // Pixel data size including mipmaps.
+            static size_t Bytes(const ::Image& image) {
+                size_t total = 0;
+                int w = image.width, h = image.height, bpp = PixelConvert::BytesPerPixel(image.format);
+                for (int level = 0; level < (image.mipmaps > 1 ? image.mipmaps : 1); level++) {
+                    total += bpp ? size_t(w) * size_t(h) * size_t(bpp) : size_t(::GetPixelDataSize(w, h, image.format));
+                    w = w > 1 ? w / 2 : 1, h = h > 1 ? h / 2 : 1;
+                }
+                return total;
+            }
+
+        private:
+            struct Pending {
+                ::Image image;
+                size_t bytes;
+                std::shared_ptr<std::promise<::Texture2D>> promise;
+            };
+
+            ThreadPool* pool;
+            UploadSink sink;
+            mutable std::mutex lock;
+            std::condition_variable decoded;
+            std::deque<Pending> queue;
+            size_t decoding = 0;
+            double millisecondsPerByte = 0.0;
+
+            void Push(::Image image, std::shared_ptr<std::promise<::Texture2D>> promise) {
+                std::lock_guard<std::mutex> g(lock);
+                queue.push_back({ image, Bytes(image), std::move(promise) });
+            }
+
+        public:
+            Budget budget;
+
+            explicit AsyncTextureLoader(ThreadPool* pool = &ThreadPool::Default(), UploadSink sink = GpuSink())
+                : pool(pool), sink(std::move(sink)) {}
+
+            AsyncTextureLoader(const AsyncTextureLoader&) = delete;
+            AsyncTextureLoader& operator = (const AsyncTextureLoader&) = delete;
+
+            ~AsyncTextureLoader() {
+                std::unique_lock<std::mutex> g(lock);
+                decoded.wait(g, [&] { return decoding == 0; });
+                for (Pending& item : queue) {
+                    if (item.image.data) sink.release(item.image);
+                    item.promise->set_value(::Texture2D {});
+                }
+            }
+
+            // Decodes with decode() on a worker thread, then queues the image for upload.
+            std::shared_future<::Texture2D> Load(std::function<::Image()> decode) {
+                std::shared_ptr<std::promise<::Texture2D>> promise = std::make_shared<std::promise<::Texture2D>>();
+                std::shared_future<::Texture2D> result = promise->get_future().share();
+                {
+                    std::lock_guard<std::mutex> g(lock);
+                    decoding++;
+                }
+
+                auto task = [this, decode, promise] {
+                    try {
+                        Push(decode(), promise);
+                    } catch (...) {
+                        promise->set_exception(std::current_exception());
+                    }
+                    std::lock_guard<std::mutex> g(lock);
+                    decoding--;
+                    decoded.notify_all();
+                };
+                if (pool) pool->Submit(task);
+                else task();
+                return result;
+            }
+
+            std::shared_future<::Texture2D> Load(const char* fileName) {
+                std::string name(fileName ? fileName : "");
+                return Load([name] { return ::LoadImage(name.c_str()); });
+            }
+
+            // Queues an already decoded image; the loader releases it after upload.
+            std::shared_future<::Texture2D> Upload(::Image image) {
+                std::shared_ptr<std::promise<::Texture2D>> promise = std::make_shared<std::promise<::Texture2D>>();
+                std::shared_future<::Texture2D> result = promise->get_future().share();
+                Push(image, promise);
+                return result;
+            }
+
+            // Uploads queued images within the budget; returns how many were uploaded. Call on the render thread.
+            size_t Update() {
+                typedef std::chrono::steady_clock Clock;
+                Clock::time_point start = Clock::now();
+                size_t uploaded = 0, spent = 0;
+
+                for (;;) {
+                    Pending item;
+                    {
+                        std::lock_guard<std::mutex> g(lock);
+                        if (queue.empty()) break;
+                        const Pending& next = queue.front();
+                        if (uploaded > 0) {
+                            double elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+                            if (spent + next.bytes > budget.bytes || elapsed + next.bytes * millisecondsPerByte > budget.milliseconds) break;
+                        }
+                        item = std::move(queue.front());
+                        queue.pop_front();
+                    }
+
+                    ::Texture2D texture {};
+                    if (item.image.data) {
+                        Clock::time_point before = Clock::now();
+                        texture = sink.upload(item.image);
+                        double took = std::chrono::duration<double, std::milli>(Clock::now() - before).count();
+                        if (item.bytes) {
+                            double rate = took / double(item.bytes);
+                            millisecondsPerByte = millisecondsPerByte == 0.0 ? rate : millisecondsPerByte * 0.75 + rate * 0.25;
+                        }
+                        sink.release(item.image);
+                    }
+                    item.promise->set_value(texture);
+                    spent += item.bytes, uploaded++;
+                }
+                return uploaded;
+            }
+
+            // Waits for every decode, then uploads everything regardless of budget (e.g. behind a loading screen).
+            size_t Finish() {
+                {
+                    std::unique_lock<std::mutex> g(lock);
+                    decoded.wait(g, [&] { return decoding == 0; });
+                }
+                Budget saved = budget;
+                budget = Budget { 1e30f, ~size_t(0) };
+                size_t uploaded = Update();
+                budget = saved;
+                return uploaded;
+            }
+
+            size_t Decoding() const {
+                std::lock_guard<std::mutex> g(lock);
+                return decoding;
+            }
+
+            size_t Queued() const {
+                std::lock_guard<std::mutex> g(lock);
+                return queue.size();
+            }
+        };
+    }
+}
+#endif
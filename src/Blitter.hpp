@@ -0,0 +1,204 @@
+/*
+    RGBA8 image blitting for CPU-side compositing (UI, decals), used by Image::Blit.
+
+    Blitter::Blit draws a source rectangle into a destination rectangle of another RGBA8 buffer:
+
+        Blitter::Blit(src.data, src.w, src.h, srcRec, dst.data, dst.w, dst.h, dstRec, tint,
+            BlitFilter::Bilinear, false, pool);
+
+    The destination rectangle is clipped to the destination image and the source rectangle to the
+    source image (as ImageDraw does). When the rectangles differ in size the source is sampled per
+    destination pixel with nearest or bilinear filtering. No intermediate resized image is made.
+    Rows are independent and are split across the pool if one is given. Blit also takes ImageViews,
+    so either side can be a sub-rectangle of a larger image without copying it.
+
+    Blending is per row:
+        - Straight alpha: ColorBatch::Blend, the same bytes as ImageDraw's ColorAlphaBlend.
+        - Premultiplied alpha: out = src * tint + dest * (1 - src.a), rounded. Source and
+          destination must both hold premultiplied colour.
+        - Fast paths: a row whose sampled source pixels are all opaque, blitted with a white tint,
+          is a plain copy. In premultiplied mode an opaque row with an opaque tint is only
+          multiplied by the tint, without reading the destination.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_BLITTER
+#define RAYLIB_PLUSPLUS_BLITTER
+#include "./RaylibExtern.hpp"
+#include "./Colors.hpp"
+#include "./ColorBatch.hpp"
+#include "./ImageView.hpp"
+#include "./Simd.hpp"
+#include "./ThreadPool.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace raylib {
+    namespace cpp {
+        enum class BlitFilter { Nearest, Bilinear };
+
+        class Blitter {
+        private:
+            static const uint8_t* Bytes(const Colors* c) { return reinterpret_cast<const uint8_t*>(c); }
+            static uint8_t* Bytes(Colors* c) { return reinterpret_cast<uint8_t*>(c); }
+
+            static bool Opaque(const Colors* row, size_t count) {
+                uint8_t alpha = 0xFF;
+                for (size_t i = 0; i < count; i++) alpha &= row[i].a;
+                return alpha == 0xFF;
+            }
+
+            // Source rows/columns for each destination row/column: nearest index, or the bilinear pair & weight.
+            struct Axis {
+                std::vector<int> first, second;
+                std::vector<float> weight;
+
+                Axis(int srcStart, int srcSize, int dstStart, int dstSize, int visibleBegin, int visibleEnd, BlitFilter filter) {
+                    size_t count = size_t(visibleEnd - visibleBegin);
+                    first.resize(count), second.resize(count), weight.resize(count);
+                    float scale = float(srcSize) / float(dstSize);
+                    for (size_t i = 0; i < count; i++) {
+                        float center = (float(visibleBegin + int(i) - dstStart) + 0.5f) * scale;
+                        if (filter == BlitFilter::Nearest) {
+                            int s = static_cast<int>(center);
+                            first[i] = second[i] = srcStart + (s < srcSize ? s : srcSize - 1), weight[i] = 0.0f;
+                        } else {
+                            float u = center - 0.5f;
+                            u = u < 0.0f ? 0.0f : (u > float(srcSize - 1) ? float(srcSize - 1) : u);
+                            int s = static_cast<int>(u);
+                            first[i] = srcStart + s, second[i] = srcStart + (s + 1 < srcSize ? s + 1 : s), weight[i] = u - float(s);
+                        }
+                    }
+                }
+            };
+
+            static void SampleNearest(const Colors* srcRow, const Axis& columns, Colors* out) {
+                for (size_t i = 0; i < columns.first.size(); i++) out[i] = srcRow[columns.first[i]];
+            }
+
+            static void SampleBilinear(const Colors* top, const Colors* bottom, float fy, const Axis& columns, Colors* out) {
+                simd::Batch(columns.first.size(), [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    constexpr int W = simd::Width<F>();
+                    alignas(32) Colors p[4][W];
+                    for (int l = 0; l < W; l++) {
+                        int x0 = columns.first[i + l], x1 = columns.second[i + l];
+                        p[0][l] = top[x0], p[1][l] = top[x1], p[2][l] = bottom[x0], p[3][l] = bottom[x1];
+                    }
+
+                    F fx = simd::Load<F>(columns.weight.data() + i), wy = F(fy);
+                    F c[4][4];
+                    for (int k = 0; k < 4; k++)
+                        simd::LoadRgba8(Bytes(p[k]), c[k][0], c[k][1], c[k][2], c[k][3]);
+
+                    F o[4];
+                    for (int ch = 0; ch < 4; ch++) {
+                        F upper = c[0][ch] + (c[1][ch] - c[0][ch]) * fx;
+                        F lower = c[2][ch] + (c[3][ch] - c[2][ch]) * fx;
+                        o[ch] = simd::Floor(upper + (lower - upper) * wy + F(0.5f));
+                    }
+                    simd::StoreRgba8(o[0], o[1], o[2], o[3], Bytes(out + i));
+                });
+            }
+
+            // Premultiplied dest = src * tint for opaque src rows & tints (alpha stays 255).
+            static void Tint(const Colors* src, Colors* dest, size_t count, Colors tint) {
+                simd::Batch(count, [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F r, g, b, a;
+                    simd::LoadRgba8(Bytes(src + i), r, g, b, a);
+                    simd::StoreRgba8(simd::Floor(r * F(tint.r / 255.0f) + F(0.5f)), simd::Floor(g * F(tint.g / 255.0f) + F(0.5f)),
+                        simd::Floor(b * F(tint.b / 255.0f) + F(0.5f)), F(tint.a), Bytes(dest + i));
+                });
+            }
+
+            static void BlendPremultiplied(const Colors* src, Colors* dest, size_t count, Colors tint) {
+                // Tint applies to premultiplied colour as rgb * (tint.rgb * tint.a) and a * tint.a.
+                float ta = tint.a / 255.0f;
+                float tr = tint.r / 255.0f * ta, tg = tint.g / 255.0f * ta, tb = tint.b / 255.0f * ta;
+                simd::Batch(count, [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F sr, sg, sb, sa, dr, dg, db, da;
+                    simd::LoadRgba8(Bytes(src + i), sr, sg, sb, sa);
+                    simd::LoadRgba8(Bytes(dest + i), dr, dg, db, da);
+                    sr = sr * F(tr), sg = sg * F(tg), sb = sb * F(tb), sa = sa * F(ta);
+
+                    F inverse = (F(255.0f) - sa) * F(1.0f / 255.0f);
+                    simd::StoreRgba8(simd::Floor(sr + dr * inverse + F(0.5f)), simd::Floor(sg + dg * inverse + F(0.5f)),
+                        simd::Floor(sb + db * inverse + F(0.5f)), simd::Floor(sa + da * inverse + F(0.5f)), Bytes(dest + i));
+                });
+            }
+
+        public:
+            // Destination rows per pool task.
+            static constexpr int parallelRows = 16;
+
+            static void Blit(const void* src, int srcWidth, int srcHeight, ::Rectangle srcRec, void* dest, int destWidth, int destHeight, ::Rectangle destRec,
+                Colors tint = Colors::White(), BlitFilter filter = BlitFilter::Nearest, bool premultiplied = false, ThreadPool* pool = nullptr) {
+                Blit(ImageView(const_cast<void*>(src), srcWidth, srcHeight, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8), srcRec,
+                    ImageView(dest, destWidth, destHeight, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8), destRec, tint, filter, premultiplied, pool);
+            }
+
+            // Views may be sub-rectangles of larger images (rows stride bytes apart); both must be RGBA8.
+            static void Blit(const ImageView& src, ::Rectangle srcRec, const ImageView& dest, ::Rectangle destRec,
+                Colors tint = Colors::White(), BlitFilter filter = BlitFilter::Nearest, bool premultiplied = false, ThreadPool* pool = nullptr) {
+                if (src.Empty() || dest.Empty() || src.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 || dest.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) return;
+                int srcWidth = src.width, srcHeight = src.height, destWidth = dest.width, destHeight = dest.height;
+
+                // Source rectangle clipped to the source image, as ImageDraw does.
+                int sx = static_cast<int>(srcRec.x), sy = static_cast<int>(srcRec.y);
+                int sw = static_cast<int>(srcRec.width), sh = static_cast<int>(srcRec.height);
+                if (sx < 0) sw += sx, sx = 0;
+                if (sy < 0) sh += sy, sy = 0;
+                if (sx + sw > srcWidth) sw = srcWidth - sx;
+                if (sy + sh > srcHeight) sh = srcHeight - sy;
+
+                int dx = static_cast<int>(destRec.x), dy = static_cast<int>(destRec.y);
+                int dw = static_cast<int>(destRec.width), dh = static_cast<int>(destRec.height);
+                if (sw <= 0 || sh <= 0 || dw <= 0 || dh <= 0 || tint.a == 0) return;
+
+                // Visible part of the destination rectangle; the mapping still uses the whole of it.
+                int x0 = dx > 0 ? dx : 0, y0 = dy > 0 ? dy : 0;
+                int x1 = dx + dw < destWidth ? dx + dw : destWidth, y1 = dy + dh < destHeight ? dy + dh : destHeight;
+                if (x0 >= x1 || y0 >= y1) return;
+
+                bool scaled = sw != dw || sh != dh;
+                Axis columns(sx, sw, dx, dw, x0, x1, filter), rows(sy, sh, dy, dh, y0, y1, filter);
+                size_t width = size_t(x1 - x0);
+                bool white = tint.r == 255 && tint.g == 255 && tint.b == 255 && tint.a == 255;
+
+                auto body = [&](size_t begin, size_t end) {
+                    std::vector<Colors> sampled(scaled ? width : 0);
+                    for (size_t r = begin; r < end; r++) {
+                        const Colors* row;
+                        if (!scaled) {
+                            row = src.Row<const Colors>(rows.first[r]) + (sx + x0 - dx);
+                        } else if (filter == BlitFilter::Nearest) {
+                            SampleNearest(src.Row<const Colors>(rows.first[r]), columns, sampled.data()), row = sampled.data();
+                        } else {
+                            SampleBilinear(src.Row<const Colors>(rows.first[r]), src.Row<const Colors>(rows.second[r]), rows.weight[r], columns, sampled.data());
+                            row = sampled.data();
+                        }
+
+                        Colors* target = dest.Row<Colors>(y0 + int(r)) + x0;
+                        bool opaque = tint.a == 255 && Opaque(row, width);
+                        if (opaque && white) {
+                            std::memcpy(target, row, width * sizeof(Colors));
+                        } else if (premultiplied) {
+                            if (opaque) Tint(row, target, width, tint);
+                            else BlendPremultiplied(row, target, width, tint);
+                        } else {
+                            ColorBatch::Blend(row, target, width, tint);
+                        }
+                    }
+                };
+
+                size_t count = size_t(y1 - y0);
+                if (pool && count >= 2 * size_t(parallelRows)) pool->ParallelFor(count, size_t(parallelRows), body);
+                else body(0, count);
+            }
+        };
+    }
+}
+#endif
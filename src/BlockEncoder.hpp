@@ -0,0 +1,504 @@
+/*
+    CPU encoder for the GPU block-compressed formats raylib can upload, used by Image::Compress.
+
+        image.Compress(PIXELFORMAT_COMPRESSED_DXT5_RGBA, BlockQuality::Normal, &pool);
+        BlockEncoder::Encode(image.View(), blocks, PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA, BlockQuality::High, &pool);
+
+    Formats (4x4 pixel blocks):
+        DXT1_RGB        BC1, 8 bytes, 4-colour mode
+        DXT1_RGBA       BC1, pixels with alpha below 128 become transparent (3-colour mode)
+        DXT3_RGBA       BC2, explicit 4-bit alpha + BC1 colour
+        DXT5_RGBA       BC3, BC4 alpha block + BC1 colour
+        ETC1_RGB        individual / differential modes, both flips
+        ETC2_RGB        the same blocks; ETC1 is a subset of ETC2 (T, H and planar modes are not used)
+        ETC2_EAC_RGBA   EAC alpha block + ETC2 colour
+    EncodeBc4 and EncodeBc5 encode single and two-channel blocks (BC4/BC5, e.g. for normal maps);
+    raylib has no pixel format for them, so they are block functions only.
+
+    BlockQuality trades speed for error. Fast takes BC1 endpoints from the bounding box, BC4 and EAC
+    from the value range, and ETC bases from subblock averages. Normal fits BC1 along the principal
+    axis with a least-squares refinement, tries both BC4 modes and a small EAC base/multiplier search,
+    and tries both ETC modes. High refines further, then searches neighbouring endpoints and bases.
+    Error is squared RGB (and alpha) distance, unweighted.
+
+    Every block is independent: rows of blocks are split across the pool, and the per-pixel palette
+    searches run in simd::Batch lanes. Sources are RGBA8 views; edge blocks of sizes that are not a
+    multiple of 4 repeat the last row and column. The output has one block per started 4x4 tile, which
+    is what the GPU expects (Size).
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_BLOCK_ENCODER
+#define RAYLIB_PLUSPLUS_BLOCK_ENCODER
+#include "./RaylibExtern.hpp"
+#include "./ImageView.hpp"
+#include "./Simd.hpp"
+#include "./ThreadPool.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace raylib {
+    namespace cpp {
+        enum class BlockQuality { Fast, Normal, High };
+
+        class BlockEncoder {
+        private:
+            // One block as planar floats (r, g, b, a), pixel i at (i % 4, i / 4).
+            struct Block {
+                float c[4][16];
+            };
+
+            static Block Gather(const ImageView& src, int bx, int by) {
+                Block block;
+                for (int y = 0; y < 4; y++) {
+                    const uint8_t* row = src.Row(by * 4 + y < src.height ? by * 4 + y : src.height - 1);
+                    for (int x = 0; x < 4; x++) {
+                        const uint8_t* p = row + size_t(bx * 4 + x < src.width ? bx * 4 + x : src.width - 1) * 4;
+                        for (int c = 0; c < 4; c++) block.c[c][y * 4 + x] = p[c];
+                    }
+                }
+                return block;
+            }
+
+            static int Clamp(int v, int lo, int hi) { return v < lo ? lo : (v > hi ? hi : v); }
+            static float Clamp255(float v) { return v < 0.0f ? 0.0f : (v > 255.0f ? 255.0f : v); }
+            static int Quantize(float v, int max) { return Clamp(static_cast<int>(v * max / 255.0f + 0.5f), 0, max); }
+
+            /*
+                Nearest of `count` palette colours for each of n (8 or 16) pixels, over `channels` channels.
+                Writes the indices and returns the squared error, each pixel's error scaled by weight.
+            */
+            static float Nearest(const float* const* pixels, int channels, int n, const float (*palette)[3], int count, const float* weight, uint8_t* out) {
+                float index[16], error[16];
+                simd::Batch(size_t(n), [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F best(3.0e38f), bestIndex(0.0f);
+                    for (int k = 0; k < count; k++) {
+                        F d(0.0f);
+                        for (int c = 0; c < channels; c++) {
+                            F diff = simd::Load<F>(pixels[c] + i) - F(palette[k][c]);
+                            d = d + diff * diff;
+                        }
+                        auto closer = d < best;
+                        best = simd::Select(closer, d, best), bestIndex = simd::Select(closer, F(float(k)), bestIndex);
+                    }
+                    if (weight) best = best * simd::Load<F>(weight + i);
+                    simd::Store(best, error + i), simd::Store(bestIndex, index + i);
+                });
+                float total = 0.0f;
+                for (int i = 0; i < n; i++) out[i] = static_cast<uint8_t>(index[i]), total += error[i];
+                return total;
+            }
+
+            #pragma region BC1
+            static int Pack565(const float e[3]) { return (Quantize(e[0], 31) << 11) | (Quantize(e[1], 63) << 5) | Quantize(e[2], 31); }
+
+            static void Unpack565(int c, float e[3]) {
+                int r = (c >> 11) & 31, g = (c >> 5) & 63, b = c & 31;
+                e[0] = float((r << 3) | (r >> 2)), e[1] = float((g << 2) | (g >> 4)), e[2] = float((b << 3) | (b >> 2));
+            }
+
+            struct ColorFit {
+                int c0 = 0, c1 = 0;
+                uint8_t index[16] = {};
+                float error = 3.0e38f;
+            };
+
+            // Orders and evaluates a 565 endpoint pair; four-colour mode unless the block has transparent pixels.
+            static void TryColor(const Block& block, const float* weight, bool transparent, int c0, int c1, ColorFit& best) {
+                if (transparent ? c0 > c1 : c0 < c1) { int t = c0; c0 = c1, c1 = t; }
+                bool four = !transparent && c0 != c1;
+                float palette[4][3];
+                Unpack565(c0, palette[0]), Unpack565(c1, palette[1]);
+                for (int c = 0; c < 3; c++) {
+                    if (four) palette[2][c] = (2.0f * palette[0][c] + palette[1][c]) / 3.0f, palette[3][c] = (palette[0][c] + 2.0f * palette[1][c]) / 3.0f;
+                    else palette[2][c] = (palette[0][c] + palette[1][c]) / 2.0f, palette[3][c] = 0.0f;
+                }
+                const float* pixels[3] = { block.c[0], block.c[1], block.c[2] };
+                ColorFit fit;
+                fit.error = Nearest(pixels, 3, 16, palette, four ? 4 : 3, weight, fit.index);
+                if (fit.error < best.error) {
+                    fit.c0 = c0, fit.c1 = c1;
+                    for (int i = 0; i < 16; i++) if (weight[i] == 0.0f) fit.index[i] = 3;
+                    best = fit;
+                }
+            }
+
+            // Least-squares endpoints for the current indices; false if the indices do not separate them.
+            static bool Refine(const Block& block, const float* weight, const ColorFit& fit, bool transparent, float e0[3], float e1[3]) {
+                bool four = !transparent && fit.c0 != fit.c1;
+                const float toward[4] = { 0.0f, 1.0f, four ? 1.0f / 3.0f : 0.5f, 2.0f / 3.0f };
+                float aa = 0.0f, ab = 0.0f, bb = 0.0f, ax[3] = {}, bx[3] = {};
+                for (int i = 0; i < 16; i++) {
+                    if (weight[i] == 0.0f) continue;
+                    float t = toward[fit.index[i]], s = 1.0f - t;
+                    aa += s * s, ab += s * t, bb += t * t;
+                    for (int c = 0; c < 3; c++) ax[c] += s * block.c[c][i], bx[c] += t * block.c[c][i];
+                }
+                float det = aa * bb - ab * ab;
+                if (std::fabs(det) < 1e-6f) return false;
+                for (int c = 0; c < 3; c++) {
+                    e0[c] = Clamp255((ax[c] * bb - bx[c] * ab) / det);
+                    e1[c] = Clamp255((bx[c] * aa - ax[c] * ab) / det);
+                }
+                return true;
+            }
+
+            // BC1 colour block into out[0..7]. With alpha, pixels whose alpha is below 128 are transparent.
+            static void EncodeColor(const Block& block, bool alpha, BlockQuality quality, uint8_t* out) {
+                float weight[16], mean[3] = {}, lo[3] = { 255.0f, 255.0f, 255.0f }, hi[3] = {};
+                int opaque = 0;
+                for (int i = 0; i < 16; i++) {
+                    weight[i] = alpha && block.c[3][i] < 128.0f ? 0.0f : 1.0f;
+                    if (weight[i] == 0.0f) continue;
+                    opaque++;
+                    for (int c = 0; c < 3; c++) {
+                        float v = block.c[c][i];
+                        mean[c] += v, lo[c] = v < lo[c] ? v : lo[c], hi[c] = v > hi[c] ? v : hi[c];
+                    }
+                }
+                bool transparent = opaque < 16;
+                ColorFit best;
+                if (opaque == 0) {
+                    best.c0 = best.c1 = 0;
+                    for (int i = 0; i < 16; i++) best.index[i] = 3;
+                } else {
+                    float e0[3], e1[3];
+                    for (int c = 0; c < 3; c++) mean[c] /= float(opaque);
+                    if (quality == BlockQuality::Fast) {
+                        // Bounding box, inset by 1/16 of its size.
+                        for (int c = 0; c < 3; c++) {
+                            float inset = (hi[c] - lo[c]) / 16.0f;
+                            e0[c] = hi[c] - inset, e1[c] = lo[c] + inset;
+                        }
+                    } else {
+                        // Principal axis by power iteration on the covariance, endpoints at the extreme projections.
+                        float cov[6] = {};
+                        for (int i = 0; i < 16; i++) {
+                            if (weight[i] == 0.0f) continue;
+                            float d[3] = { block.c[0][i] - mean[0], block.c[1][i] - mean[1], block.c[2][i] - mean[2] };
+                            cov[0] += d[0] * d[0], cov[1] += d[0] * d[1], cov[2] += d[0] * d[2];
+                            cov[3] += d[1] * d[1], cov[4] += d[1] * d[2], cov[5] += d[2] * d[2];
+                        }
+                        float axis[3] = { hi[0] - lo[0], hi[1] - lo[1], hi[2] - lo[2] };
+                        for (int k = 0; k < 8; k++) {
+                            float next[3] = {
+                                cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2],
+                                cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2],
+                                cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2] };
+                            float length = std::sqrt(next[0] * next[0] + next[1] * next[1] + next[2] * next[2]);
+                            if (length < 1e-6f) break;
+                            for (int c = 0; c < 3; c++) axis[c] = next[c] / length;
+                        }
+                        float tMin = 3.0e38f, tMax = -3.0e38f;
+                        for (int i = 0; i < 16; i++) {
+                            if (weight[i] == 0.0f) continue;
+                            float t = (block.c[0][i] - mean[0]) * axis[0] + (block.c[1][i] - mean[1]) * axis[1] + (block.c[2][i] - mean[2]) * axis[2];
+                            tMin = t < tMin ? t : tMin, tMax = t > tMax ? t : tMax;
+                        }
+                        for (int c = 0; c < 3; c++) e0[c] = Clamp255(mean[c] + axis[c] * tMax), e1[c] = Clamp255(mean[c] + axis[c] * tMin);
+                    }
+                    TryColor(block, weight, transparent, Pack565(e0), Pack565(e1), best);
+
+                    int passes = quality == BlockQuality::Fast ? 0 : (quality == BlockQuality::Normal ? 1 : 3);
+                    for (int pass = 0; pass < passes && best.error > 0.0f; pass++) {
+                        if (!Refine(block, weight, best, transparent, e0, e1)) break;
+                        TryColor(block, weight, transparent, Pack565(e0), Pack565(e1), best);
+                    }
+
+                    if (quality == BlockQuality::High) {
+                        // Greedy +-1 steps on each 565 component of each endpoint.
+                        const int fields[3][2] = { { 11, 31 }, { 5, 63 }, { 0, 31 } };
+                        for (bool improved = true; improved && best.error > 0.0f;) {
+                            improved = false;
+                            for (int e = 0; e < 2; e++)
+                                for (int f = 0; f < 3; f++)
+                                    for (int step = -1; step <= 1; step += 2) {
+                                        int c[2] = { best.c0, best.c1 };
+                                        int v = ((c[e] >> fields[f][0]) & fields[f][1]) + step;
+                                        if (v < 0 || v > fields[f][1]) continue;
+                                        c[e] = (c[e] & ~(fields[f][1] << fields[f][0])) | (v << fields[f][0]);
+                                        float before = best.error;
+                                        TryColor(block, weight, transparent, c[0], c[1], best);
+                                        improved = improved || best.error < before;
+                                    }
+                        }
+                    }
+                }
+
+                uint32_t bits = 0;
+                for (int i = 0; i < 16; i++) bits |= uint32_t(best.index[i]) << (2 * i);
+                out[0] = uint8_t(best.c0), out[1] = uint8_t(best.c0 >> 8), out[2] = uint8_t(best.c1), out[3] = uint8_t(best.c1 >> 8);
+                for (int k = 0; k < 4; k++) out[4 + k] = uint8_t(bits >> (8 * k));
+            }
+            #pragma endregion BC1
+
+            #pragma region BC4
+            // Interpolated palette for a BC4 endpoint pair: 8 values if a0 > a1, otherwise 6 plus 0 and 255.
+            static float TryBc4(const float* values, int a0, int a1, uint8_t* index) {
+                float palette[8][3] = {};
+                palette[0][0] = float(a0), palette[1][0] = float(a1);
+                if (a0 > a1) {
+                    for (int i = 2; i < 8; i++) palette[i][0] = ((8 - i) * a0 + (i - 1) * a1) / 7.0f;
+                } else {
+                    for (int i = 2; i < 6; i++) palette[i][0] = ((6 - i) * a0 + (i - 1) * a1) / 5.0f;
+                    palette[6][0] = 0.0f, palette[7][0] = 255.0f;
+                }
+                return Nearest(&values, 1, 16, palette, 8, nullptr, index);
+            }
+
+            static void EncodeBc4(const float* values, BlockQuality quality, uint8_t* out) {
+                int lo = 255, hi = 0, innerLo = 255, innerHi = 0;
+                for (int i = 0; i < 16; i++) {
+                    int v = static_cast<int>(values[i]);
+                    lo = v < lo ? v : lo, hi = v > hi ? v : hi;
+                    if (v > 0 && v < 255) innerLo = v < innerLo ? v : innerLo, innerHi = v > innerHi ? v : innerHi;
+                }
+                int a0 = hi, a1 = lo;
+                uint8_t bestIndex[16], index[16];
+                float bestError = TryBc4(values, a0, a1, bestIndex);
+                auto consider = [&](int c0, int c1) {
+                    float error = TryBc4(values, c0, c1, index);
+                    if (error < bestError) bestError = error, a0 = c0, a1 = c1, std::memcpy(bestIndex, index, sizeof(index));
+                };
+                // The 6-value mode keeps 0 and 255 exact and spends its steps on the values in between.
+                if (quality != BlockQuality::Fast && innerLo <= innerHi && bestError > 0.0f) consider(innerLo, innerHi);
+                if (quality == BlockQuality::High)
+                    for (int d0 = 0; d0 < 4 && bestError > 0.0f; d0++)
+                        for (int d1 = 0; d1 < 4; d1++)
+                            if (hi - d0 > lo + d1 && (d0 || d1)) consider(hi - d0, lo + d1);
+
+                out[0] = uint8_t(a0), out[1] = uint8_t(a1);
+                uint64_t bits = 0;
+                for (int i = 0; i < 16; i++) bits |= uint64_t(bestIndex[i]) << (3 * i);
+                for (int k = 0; k < 6; k++) out[2 + k] = uint8_t(bits >> (8 * k));
+            }
+            #pragma endregion BC4
+
+            #pragma region ETC
+            static constexpr int etcModifiers[8][2] = { { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 } };
+
+            // Pixel k of half h. No flip: 2x4 halves side by side. Flip: 4x2 halves stacked.
+            static int HalfPixel(bool flip, int h, int k) {
+                int x = flip ? k % 4 : h * 2 + k % 2, y = flip ? h * 2 + k / 4 : k / 2;
+                return y * 4 + x;
+            }
+
+            struct HalfFit {
+                int table = 0;
+                uint8_t index[8] = {};
+                float error = 3.0e38f;
+            };
+
+            // Best modifier table and per-pixel modifiers for 8 pixels around an (expanded) base colour.
+            static HalfFit FitHalf(const float* const* pixels, const int base[3]) {
+                HalfFit best;
+                for (int t = 0; t < 8 && best.error > 0.0f; t++) {
+                    const int modifier[4] = { etcModifiers[t][0], etcModifiers[t][1], -etcModifiers[t][0], -etcModifiers[t][1] };
+                    float palette[4][3];
+                    for (int k = 0; k < 4; k++)
+                        for (int c = 0; c < 3; c++) palette[k][c] = float(Clamp(base[c] + modifier[k], 0, 255));
+                    HalfFit fit;
+                    fit.table = t;
+                    fit.error = Nearest(pixels, 3, 8, palette, 4, nullptr, fit.index);
+                    if (fit.error < best.error) best = fit;
+                }
+                return best;
+            }
+
+            // ETC1 block (valid ETC2): differential or individual mode, both flips.
+            static void EncodeEtc(const Block& block, BlockQuality quality, uint8_t* out) {
+                struct {
+                    bool differential = false, flip = false;
+                    int base[2][3] = {};
+                    HalfFit half[2];
+                    float error = 3.0e38f;
+                } best;
+                // Base colour candidates per half: the quantized mean, and for High one step darker and lighter.
+                const int offsets[3] = { 0, -1, 1 };
+                int steps = quality == BlockQuality::High ? 3 : 1;
+
+                for (int flip = 0; flip < 2; flip++) {
+                    float halves[2][3][8], mean[2][3] = {};
+                    const float* pixels[2][3];
+                    for (int h = 0; h < 2; h++) {
+                        for (int c = 0; c < 3; c++) {
+                            for (int k = 0; k < 8; k++) halves[h][c][k] = block.c[c][HalfPixel(flip != 0, h, k)], mean[h][c] += halves[h][c][k] / 8.0f;
+                            pixels[h][c] = halves[h][c];
+                        }
+                    }
+
+                    bool found = false;
+                    for (int mode = 0; mode < 2; mode++) {
+                        bool differential = mode == 0;
+                        if (quality == BlockQuality::Fast && found) break;
+                        int max = differential ? 31 : 15;
+                        int candidate[2][3][3];
+                        bool valid[2][3];
+                        HalfFit fits[2][3];
+                        for (int h = 0; h < 2; h++)
+                            for (int s = 0; s < steps; s++) {
+                                int base[3];
+                                valid[h][s] = true;
+                                for (int c = 0; c < 3; c++) {
+                                    int v = Quantize(mean[h][c], max) + offsets[s];
+                                    valid[h][s] = valid[h][s] && v >= 0 && v <= max;
+                                    candidate[h][s][c] = v = Clamp(v, 0, max);
+                                    base[c] = differential ? (v << 3) | (v >> 2) : v * 17;
+                                }
+                                if (valid[h][s]) fits[h][s] = FitHalf(pixels[h], base);
+                            }
+
+                        for (int s0 = 0; s0 < steps; s0++)
+                            for (int s1 = 0; s1 < steps; s1++) {
+                                if (!valid[0][s0] || !valid[1][s1]) continue;
+                                bool representable = true;
+                                // The second differential base is stored as a 3-bit signed offset from the first.
+                                for (int c = 0; c < 3 && differential; c++) {
+                                    int d = candidate[1][s1][c] - candidate[0][s0][c];
+                                    representable = representable && d >= -4 && d <= 3;
+                                }
+                                if (!representable) continue;
+                                found = true;
+                                float error = fits[0][s0].error + fits[1][s1].error;
+                                if (error >= best.error) continue;
+                                best.differential = differential, best.flip = flip != 0, best.error = error;
+                                best.half[0] = fits[0][s0], best.half[1] = fits[1][s1];
+                                for (int c = 0; c < 3; c++) best.base[0][c] = candidate[0][s0][c], best.base[1][c] = candidate[1][s1][c];
+                            }
+                    }
+                }
+
+                for (int c = 0; c < 3; c++)
+                    out[c] = uint8_t(best.differential ? (best.base[0][c] << 3) | ((best.base[1][c] - best.base[0][c]) & 7) : (best.base[0][c] << 4) | best.base[1][c]);
+                out[3] = uint8_t((best.half[0].table << 5) | (best.half[1].table << 2) | (best.differential ? 2 : 0) | (best.flip ? 1 : 0));
+                // Index planes: most significant bits, then least significant; pixels in column-major order.
+                uint32_t msb = 0, lsb = 0;
+                for (int h = 0; h < 2; h++)
+                    for (int k = 0; k < 8; k++) {
+                        int i = HalfPixel(best.flip, h, k), p = (i % 4) * 4 + i / 4, index = best.half[h].index[k];
+                        msb |= uint32_t(index >> 1) << p, lsb |= uint32_t(index & 1) << p;
+                    }
+                out[4] = uint8_t(msb >> 8), out[5] = uint8_t(msb), out[6] = uint8_t(lsb >> 8), out[7] = uint8_t(lsb);
+            }
+
+            static constexpr int eacModifiers[16][8] = {
+                { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 }, { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+                { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 }, { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+                { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 }, { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 },
+                { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 }, { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 } };
+
+            // EAC alpha block: base + multiplier * modifier, searched around the value range of each table.
+            static void EncodeEac(const float* values, BlockQuality quality, uint8_t* out) {
+                float lo = 255.0f, hi = 0.0f;
+                for (int i = 0; i < 16; i++) lo = values[i] < lo ? values[i] : lo, hi = values[i] > hi ? values[i] : hi;
+                int reach = quality == BlockQuality::Fast ? 0 : (quality == BlockQuality::Normal ? 1 : 2);
+                int bestBase = 0, bestMultiplier = 1, bestTable = 0;
+                uint8_t bestIndex[16] = {}, index[16];
+                float bestError = 3.0e38f;
+
+                for (int t = 0; t < 16 && bestError > 0.0f; t++) {
+                    int low = eacModifiers[t][3], high = eacModifiers[t][7];
+                    int m0 = Clamp(static_cast<int>((hi - lo) / float(high - low) + 0.5f), 1, 15);
+                    for (int m = m0 - reach; m <= m0 + reach && bestError > 0.0f; m++) {
+                        if (m < 1 || m > 15) continue;
+                        int b0 = static_cast<int>(std::floor((lo + hi) / 2.0f - (low + high) * m / 2.0f + 0.5f));
+                        for (int b = b0 - reach; b <= b0 + reach && bestError > 0.0f; b++) {
+                            int base = Clamp(b, 0, 255);
+                            float palette[8][3] = {};
+                            for (int k = 0; k < 8; k++) palette[k][0] = float(Clamp(base + eacModifiers[t][k] * m, 0, 255));
+                            float error = Nearest(&values, 1, 16, palette, 8, nullptr, index);
+                            if (error < bestError) {
+                                bestError = error, bestBase = base, bestMultiplier = m, bestTable = t;
+                                std::memcpy(bestIndex, index, sizeof(index));
+                            }
+                        }
+                    }
+                }
+
+                out[0] = uint8_t(bestBase), out[1] = uint8_t((bestMultiplier << 4) | bestTable);
+                // 3-bit indices, big-endian, pixels in column-major order.
+                uint64_t bits = 0;
+                for (int p = 0; p < 16; p++) bits |= uint64_t(bestIndex[(p % 4) * 4 + p / 4]) << (45 - 3 * p);
+                for (int k = 0; k < 6; k++) out[2 + k] = uint8_t(bits >> (40 - 8 * k));
+            }
+            #pragma endregion ETC
+
+            static void EncodeBlock(const Block& block, int format, BlockQuality quality, uint8_t* out) {
+                switch (format) {
+                    case PIXELFORMAT_COMPRESSED_DXT1_RGB: EncodeColor(block, false, quality, out); break;
+                    case PIXELFORMAT_COMPRESSED_DXT1_RGBA: EncodeColor(block, true, quality, out); break;
+                    case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+                        for (int i = 0; i < 8; i++) out[i] = uint8_t(Quantize(block.c[3][2 * i], 15) | (Quantize(block.c[3][2 * i + 1], 15) << 4));
+                        EncodeColor(block, false, quality, out + 8);
+                        break;
+                    case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+                        EncodeBc4(block.c[3], quality, out);
+                        EncodeColor(block, false, quality, out + 8);
+                        break;
+                    case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+                    case PIXELFORMAT_COMPRESSED_ETC2_RGB: EncodeEtc(block, quality, out); break;
+                    case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+                        EncodeEac(block.c[3], quality, out);
+                        EncodeEtc(block, quality, out + 8);
+                        break;
+                    default: break;
+                }
+            }
+
+        public:
+            // Block rows per pool task.
+            static constexpr size_t parallelRows = 4;
+
+            static int BlockBytes(int format) {
+                switch (format) {
+                    case PIXELFORMAT_COMPRESSED_DXT1_RGB:
+                    case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+                    case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+                    case PIXELFORMAT_COMPRESSED_ETC2_RGB: return 8;
+                    case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+                    case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+                    case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: return 16;
+                    default: return 0;
+                }
+            }
+
+            static bool Supported(int format) { return BlockBytes(format) != 0; }
+
+            // Bytes for one image (one mip level): a block per started 4x4 tile. raylib's GetPixelDataSize
+            // only gives the same size for whole blocks and its small-level floors; Image::Compress keeps to those.
+            static size_t Size(int width, int height, int format) {
+                return size_t((width + 3) / 4) * size_t((height + 3) / 4) * size_t(BlockBytes(format));
+            }
+
+            // Encodes an RGBA8 view into dst (Size(width, height, format) bytes). Other formats are ignored.
+            static void Encode(const ImageView& src, void* dst, int format, BlockQuality quality = BlockQuality::Normal, ThreadPool* pool = nullptr) {
+                int bytes = BlockBytes(format);
+                if (bytes == 0 || dst == nullptr || src.Empty() || src.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) return;
+                size_t blocksX = size_t((src.width + 3) / 4), blocksY = size_t((src.height + 3) / 4);
+                uint8_t* out = static_cast<uint8_t*>(dst);
+                auto body = [&](size_t begin, size_t end) {
+                    for (size_t by = begin; by < end; by++)
+                        for (size_t bx = 0; bx < blocksX; bx++)
+                            EncodeBlock(Gather(src, int(bx), int(by)), format, quality, out + (by * blocksX + bx) * bytes);
+                };
+                if (pool && blocksY >= 2 * parallelRows) pool->ParallelFor(blocksY, parallelRows, body);
+                else body(0, blocksY);
+            }
+
+            // One BC4 block (8 bytes) from 16 values in row-major order.
+            static void EncodeBc4(const uint8_t values[16], uint8_t out[8], BlockQuality quality = BlockQuality::Normal) {
+                float v[16];
+                for (int i = 0; i < 16; i++) v[i] = values[i];
+                EncodeBc4(v, quality, out);
+            }
+
+            // One BC5 block (16 bytes): a BC4 block for each channel.
+            static void EncodeBc5(const uint8_t red[16], const uint8_t green[16], uint8_t out[16], BlockQuality quality = BlockQuality::Normal) {
+                EncodeBc4(red, out, quality);
+                EncodeBc4(green, out + 8, quality);
+            }
+        };
+    }
+}
+#endif
@@ -0,0 +1,463 @@
+/*
+    Bounding volume hierarchies for ray queries (mouse picking, line of sight).
+
+    BoxBvh is built over ::BoundingBox arrays (one box per object), TriangleBvh over triangle
+    soups (three Vector3D vertices per triangle, e.g. a Mesh's vertex array). Both share Bvh<>:
+
+        TriangleBvh bvh(vertices, triangleCount, &ThreadPool::Default());
+        uint32_t triangle;
+        RayCollision hit = bvh.ClosestHit(camera.GetMouseRay(GetMousePosition()), &triangle);
+
+    Build uses binned SAH (16 bins per axis). Large nodes are binned in parallel when a
+    ThreadPool is given. Refit() keeps the tree topology and only recomputes bounds, which is
+    much cheaper than a rebuild for objects that move a little each frame.
+
+    Traversal visits the nearer child first and prunes by the closest hit so far. AnyHit stops
+    at the first hit within maxDistance (shadow/line-of-sight rays). The batch versions split
+    rays across a ThreadPool. Hit results follow raylib's RayCollision conventions: box hits
+    match GetRayCollisionBox for rays starting outside the box; triangle hits use the same
+    Moller-Trumbore test as GetRayCollisionTriangle.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_BVH
+#define RAYLIB_PLUSPLUS_BVH
+#include "./RaylibExtern.hpp"
+#include "./Vector.hpp"
+#include "./ThreadPool.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace raylib {
+    namespace cpp {
+        template<typename Derived>
+        class Bvh {
+        public:
+            // Leaf when count > 0 (primitives indices[first .. first + count)), otherwise children at first & first + 1.
+            struct Node {
+                Vector3D min;
+                uint32_t first;
+                Vector3D max;
+                uint32_t count;
+            };
+
+            static constexpr int BinCount = 16;
+            static constexpr uint32_t MaxLeafSize = 8;
+
+            // Nodes binned across threads when a pool is given and the node holds at least this many primitives.
+            size_t parallelBinThreshold = 65536;
+
+            std::vector<Node> nodes;
+            std::vector<uint32_t> indices;      // Primitive order referenced by leaves.
+
+            size_t NodeCount() const { return nodes.size(); }
+            size_t PrimitiveCount() const { return indices.size(); }
+
+            // Closest hit along ray, or hit == false. index receives the primitive index when not null.
+            ::RayCollision ClosestHit(::Ray ray, uint32_t* index = nullptr) const {
+                ::RayCollision hit = { false, FLT_MAX, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } };
+                uint32_t hitIndex = Traverse(ray, FLT_MAX, false, hit);
+                if (index) *index = hitIndex;
+                return hit;
+            }
+
+            bool AnyHit(::Ray ray, float maxDistance = FLT_MAX) const {
+                ::RayCollision hit = { false, maxDistance, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } };
+                Traverse(ray, maxDistance, true, hit);
+                return hit.hit;
+            }
+
+            void ClosestHits(const ::Ray* rays, size_t count, ::RayCollision* hits, uint32_t* hitIndices = nullptr, ThreadPool* pool = nullptr) const {
+                ParallelFor(count, 64, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                        hits[i] = ClosestHit(rays[i], hitIndices ? hitIndices + i : nullptr);
+                }, pool);
+            }
+
+            // maxDistances may be null for unbounded rays.
+            void AnyHits(const ::Ray* rays, const float* maxDistances, size_t count, bool* hits, ThreadPool* pool = nullptr) const {
+                ParallelFor(count, 64, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                        hits[i] = AnyHit(rays[i], maxDistances ? maxDistances[i] : FLT_MAX);
+                }, pool);
+            }
+
+        protected:
+            static constexpr uint32_t NoHit = 0xFFFFFFFFu;
+
+            // Per-primitive bounds & centroids, filled by the derived class before Build/RefitNodes.
+            std::vector<Vector3D> primitiveMin, primitiveMax, centroids;
+
+            struct Bin {
+                Vector3D min, max;
+                uint32_t count;
+            };
+
+            struct BinSet {
+                Bin bins[3][BinCount];
+            };
+
+            static void Grow(Vector3D& min, Vector3D& max, const Vector3D& pmin, const Vector3D& pmax) {
+                min = Vector3D(fminf(min.x, pmin.x), fminf(min.y, pmin.y), fminf(min.z, pmin.z));
+                max = Vector3D(fmaxf(max.x, pmax.x), fmaxf(max.y, pmax.y), fmaxf(max.z, pmax.z));
+            }
+
+            static float Area(const Vector3D& min, const Vector3D& max) {
+                Vector3D e = max - min;
+                return e.x * e.y + e.y * e.z + e.z * e.x;
+            }
+
+            static float Axis(const Vector3D& v, int axis) { return axis == 0 ? v.x : (axis == 1 ? v.y : v.z); }
+
+            void ComputeBounds(Node& node) const {
+                node.min = Vector3D(FLT_MAX, FLT_MAX, FLT_MAX), node.max = Vector3D(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+                for (uint32_t i = node.first; i < node.first + node.count; i++)
+                    Grow(node.min, node.max, primitiveMin[indices[i]], primitiveMax[indices[i]]);
+            }
+
+            void Build(ThreadPool* pool) {
+                uint32_t count = static_cast<uint32_t>(centroids.size());
+                indices.resize(count);
+                std::iota(indices.begin(), indices.end(), 0u);
+                nodes.clear();
+                nodes.reserve(count > 0 ? 2 * count - 1 : 1);
+
+                Node root;
+                root.first = 0, root.count = count;
+                ComputeBounds(root);
+                nodes.push_back(root);
+
+                std::vector<uint32_t> stack(1, 0u);
+                while (!stack.empty()) {
+                    uint32_t node = stack.back();
+                    stack.pop_back();
+                    if (Subdivide(node, pool))
+                        stack.push_back(nodes[node].first), stack.push_back(nodes[node].first + 1);
+                }
+            }
+
+            // Splits nodes[index] in two by binned SAH. Returns false when it stays a leaf.
+            bool Subdivide(uint32_t index, ThreadPool* pool) {
+                Node node = nodes[index];
+                if (node.count <= 2) return false;
+
+                Vector3D cmin(FLT_MAX, FLT_MAX, FLT_MAX), cmax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+                for (uint32_t i = node.first; i < node.first + node.count; i++)
+                    Grow(cmin, cmax, centroids[indices[i]], centroids[indices[i]]);
+
+                Vector3D extent = cmax - cmin;
+                float scale[3];
+                for (int a = 0; a < 3; a++)
+                    scale[a] = Axis(extent, a) > 0.0f ? BinCount / Axis(extent, a) : 0.0f;
+
+                auto binOf = [&](uint32_t primitive, int axis) {
+                    int bin = static_cast<int>((Axis(centroids[primitive], axis) - Axis(cmin, axis)) * scale[axis]);
+                    return bin < BinCount - 1 ? bin : BinCount - 1;
+                };
+
+                // Bin primitives on all three axes (in parallel chunks for big nodes).
+                auto clearBins = [](BinSet& b) {
+                    for (int a = 0; a < 3; a++)
+                        for (int i = 0; i < BinCount; i++)
+                            b.bins[a][i] = { Vector3D(FLT_MAX, FLT_MAX, FLT_MAX), Vector3D(-FLT_MAX, -FLT_MAX, -FLT_MAX), 0 };
+                };
+                auto binRange = [&](BinSet& b, uint32_t begin, uint32_t end) {
+                    for (uint32_t i = begin; i < end; i++) {
+                        uint32_t p = indices[i];
+                        for (int a = 0; a < 3; a++) {
+                            Bin& bin = b.bins[a][binOf(p, a)];
+                            Grow(bin.min, bin.max, primitiveMin[p], primitiveMax[p]);
+                            bin.count++;
+                        }
+                    }
+                };
+
+                BinSet total;
+                Bin (&bins)[3][BinCount] = total.bins;
+                clearBins(total);
+                if (pool && pool->Size() > 0 && node.count >= parallelBinThreshold) {
+                    size_t grain = (node.count + pool->Size()) / (pool->Size() + 1);
+                    std::vector<BinSet> partial((node.count + grain - 1) / grain);
+                    pool->ParallelFor(node.count, grain, [&](size_t begin, size_t end) {
+                        BinSet& b = partial[begin / grain];
+                        clearBins(b);
+                        binRange(b, node.first + static_cast<uint32_t>(begin), node.first + static_cast<uint32_t>(end));
+                    });
+
+                    for (const BinSet& b : partial)
+                        for (int a = 0; a < 3; a++)
+                            for (int i = 0; i < BinCount; i++) {
+                                const Bin& bin = b.bins[a][i];
+                                if (bin.count == 0) continue;
+                                Grow(bins[a][i].min, bins[a][i].max, bin.min, bin.max);
+                                bins[a][i].count += bin.count;
+                            }
+                } else {
+                    binRange(total, node.first, node.first + node.count);
+                }
+
+                // Sweep the bin boundaries for the cheapest split: area(left) * countLeft + area(right) * countRight.
+                float bestCost = FLT_MAX;
+                int bestAxis = -1, bestSplit = 0;
+                for (int a = 0; a < 3; a++) {
+                    if (scale[a] == 0.0f) continue;
+
+                    float leftArea[BinCount - 1];
+                    uint32_t leftCount[BinCount - 1];
+                    Vector3D lmin(FLT_MAX, FLT_MAX, FLT_MAX), lmax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+                    uint32_t sum = 0;
+                    for (int i = 0; i < BinCount - 1; i++) {
+                        if (bins[a][i].count) Grow(lmin, lmax, bins[a][i].min, bins[a][i].max);
+                        sum += bins[a][i].count;
+                        leftCount[i] = sum, leftArea[i] = sum ? Area(lmin, lmax) : 0.0f;
+                    }
+
+                    Vector3D rmin(FLT_MAX, FLT_MAX, FLT_MAX), rmax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+                    sum = 0;
+                    for (int i = BinCount - 1; i > 0; i--) {
+                        if (bins[a][i].count) Grow(rmin, rmax, bins[a][i].min, bins[a][i].max);
+                        sum += bins[a][i].count;
+                        if (sum == 0 || leftCount[i - 1] == 0) continue;
+
+                        float cost = leftArea[i - 1] * leftCount[i - 1] + Area(rmin, rmax) * sum;
+                        if (cost < bestCost) bestCost = cost, bestAxis = a, bestSplit = i;
+                    }
+                }
+
+                // Splitting must beat intersecting every primitive here; big leaves are split anyway.
+                // With no usable axis (coincident centroids) the split below is by count instead.
+                float leafCost = Area(node.min, node.max) * node.count;
+                if ((bestAxis < 0 || bestCost >= leafCost) && node.count <= MaxLeafSize) return false;
+
+                uint32_t* begin = indices.data() + node.first, * end = begin + node.count;
+                uint32_t* middle;
+                if (bestAxis >= 0) {
+                    middle = std::partition(begin, end, [&](uint32_t p) { return binOf(p, bestAxis) < bestSplit; });
+                } else {
+                    middle = begin + node.count / 2;
+                }
+
+                uint32_t leftCount = static_cast<uint32_t>(middle - begin);
+                if (leftCount == 0 || leftCount == node.count) return false;
+
+                Node left, right;
+                left.first = node.first, left.count = leftCount;
+                right.first = node.first + leftCount, right.count = node.count - leftCount;
+                ComputeBounds(left), ComputeBounds(right);
+
+                uint32_t child = static_cast<uint32_t>(nodes.size());
+                nodes.push_back(left), nodes.push_back(right);
+                nodes[index].first = child, nodes[index].count = 0;
+                return true;
+            }
+
+            // Children always come after their parent, so one reverse pass refits bottom-up.
+            void RefitNodes() {
+                for (size_t i = nodes.size(); i-- > 0;) {
+                    Node& node = nodes[i];
+                    if (node.count > 0) {
+                        ComputeBounds(node);
+                    } else {
+                        const Node& l = nodes[node.first], & r = nodes[node.first + 1];
+                        node.min = l.min, node.max = l.max;
+                        Grow(node.min, node.max, r.min, r.max);
+                    }
+                }
+            }
+
+            // Slab test; returns the entry distance or FLT_MAX when the box is missed or beyond limit.
+            static float IntersectBounds(const Vector3D& min, const Vector3D& max, const Vector3D& origin, const Vector3D& inverse, float limit) {
+                float tx1 = (min.x - origin.x) * inverse.x, tx2 = (max.x - origin.x) * inverse.x;
+                float ty1 = (min.y - origin.y) * inverse.y, ty2 = (max.y - origin.y) * inverse.y;
+                float tz1 = (min.z - origin.z) * inverse.z, tz2 = (max.z - origin.z) * inverse.z;
+                float tmin = fmaxf(fmaxf(fminf(tx1, tx2), fminf(ty1, ty2)), fminf(tz1, tz2));
+                float tmax = fminf(fminf(fmaxf(tx1, tx2), fmaxf(ty1, ty2)), fmaxf(tz1, tz2));
+                return (tmax >= tmin && tmax >= 0.0f && tmin < limit) ? tmin : FLT_MAX;
+            }
+
+            uint32_t Traverse(const ::Ray& ray, float limit, bool anyHit, ::RayCollision& hit) const {
+                if (nodes.empty()) return NoHit;
+
+                const Derived& self = static_cast<const Derived&>(*this);
+                Vector3D origin = ray.position, direction = ray.direction;
+                Vector3D inverse(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+                uint32_t hitIndex = NoHit;
+
+                if (IntersectBounds(nodes[0].min, nodes[0].max, origin, inverse, limit) == FLT_MAX) return NoHit;
+
+                // Binned SAH does not bound the depth, so nodes past the local stack spill into a vector.
+                uint32_t stack[64];
+                std::vector<uint32_t> spill;
+                int top = 0;
+                auto push = [&](uint32_t node) {
+                    if (top < 64) stack[top++] = node;
+                    else spill.push_back(node);
+                };
+                push(0);
+
+                while (top > 0) {
+                    uint32_t index;
+                    if (!spill.empty()) index = spill.back(), spill.pop_back();
+                    else index = stack[--top];
+                    const Node& node = nodes[index];
+
+                    if (node.count > 0) {
+                        for (uint32_t i = node.first; i < node.first + node.count; i++) {
+                            if (self.IntersectPrimitive(indices[i], ray, limit, hit)) {
+                                limit = hit.distance, hitIndex = indices[i];
+                                if (anyHit) return hitIndex;
+                            }
+                        }
+                        continue;
+                    }
+
+                    uint32_t first = node.first, second = node.first + 1;
+                    float tFirst = IntersectBounds(nodes[first].min, nodes[first].max, origin, inverse, limit);
+                    float tSecond = IntersectBounds(nodes[second].min, nodes[second].max, origin, inverse, limit);
+                    if (tSecond < tFirst) std::swap(first, second), std::swap(tFirst, tSecond);
+
+                    // Push the farther child first so the nearer one is visited next.
+                    if (tSecond != FLT_MAX) push(second);
+                    if (tFirst != FLT_MAX) push(first);
+                }
+
+                return hitIndex;
+            }
+        };
+
+        class BoxBvh : public Bvh<BoxBvh> {
+        private:
+            std::vector<::BoundingBox> boxes;
+
+            void SetPrimitives(const ::BoundingBox* source, size_t count) {
+                boxes.assign(source, source + count);
+                primitiveMin.resize(count), primitiveMax.resize(count), centroids.resize(count);
+                for (size_t i = 0; i < count; i++) {
+                    primitiveMin[i] = source[i].min, primitiveMax[i] = source[i].max;
+                    centroids[i] = (primitiveMin[i] + primitiveMax[i]) * 0.5f;
+                }
+            }
+
+        public:
+            BoxBvh() {}
+            BoxBvh(const ::BoundingBox* boxes, size_t count, ThreadPool* pool = nullptr) { Build(boxes, count, pool); }
+
+            BoxBvh& Build(const ::BoundingBox* source, size_t count, ThreadPool* pool = nullptr) {
+                SetPrimitives(source, count);
+                Bvh::Build(pool);
+                return (*this);
+            }
+
+            // New bounds for the same boxes (same count & order as Build); keeps the tree topology.
+            BoxBvh& Refit(const ::BoundingBox* source) {
+                SetPrimitives(source, boxes.size());
+                RefitNodes();
+                return (*this);
+            }
+
+            bool IntersectPrimitive(uint32_t index, const ::Ray& ray, float limit, ::RayCollision& hit) const {
+                Vector3D min = boxes[index].min, max = boxes[index].max;
+                Vector3D origin = ray.position, direction = ray.direction;
+                Vector3D inverse(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+
+                float t1[3] = { (min.x - origin.x) * inverse.x, (min.y - origin.y) * inverse.y, (min.z - origin.z) * inverse.z };
+                float t2[3] = { (max.x - origin.x) * inverse.x, (max.y - origin.y) * inverse.y, (max.z - origin.z) * inverse.z };
+
+                float tmin = -FLT_MAX, tmax = FLT_MAX;
+                int axis = 0;
+                for (int a = 0; a < 3; a++) {
+                    float lo = fminf(t1[a], t2[a]), hi = fmaxf(t1[a], t2[a]);
+                    if (lo > tmin) tmin = lo, axis = a;
+                    if (hi < tmax) tmax = hi;
+                }
+
+                if (tmax < tmin || tmax < 0.0f) return false;
+                float distance = tmin > 0.0f ? tmin : 0.0f;
+                if (distance >= limit) return false;
+
+                Vector3D normal(0.0f, 0.0f, 0.0f);
+                if (tmin > 0.0f) {
+                    float d = axis == 0 ? direction.x : (axis == 1 ? direction.y : direction.z);
+                    float n = d > 0.0f ? -1.0f : 1.0f;
+                    normal = Vector3D(axis == 0 ? n : 0.0f, axis == 1 ? n : 0.0f, axis == 2 ? n : 0.0f);
+                }
+
+                hit.hit = true, hit.distance = distance;
+                hit.point = origin + direction * distance, hit.normal = normal;
+                return true;
+            }
+        };
+
+        class TriangleBvh : public Bvh<TriangleBvh> {
+        private:
+            std::vector<Vector3D> vertices;
+
+            void SetPrimitives(const Vector3D* source, size_t triangleCount) {
+                vertices.assign(source, source + triangleCount * 3);
+                primitiveMin.resize(triangleCount), primitiveMax.resize(triangleCount), centroids.resize(triangleCount);
+                for (size_t i = 0; i < triangleCount; i++) {
+                    const Vector3D& a = source[3 * i], & b = source[3 * i + 1], & c = source[3 * i + 2];
+                    primitiveMin[i] = a, primitiveMax[i] = a;
+                    Grow(primitiveMin[i], primitiveMax[i], b, b);
+                    Grow(primitiveMin[i], primitiveMax[i], c, c);
+                    centroids[i] = (primitiveMin[i] + primitiveMax[i]) * 0.5f;
+                }
+            }
+
+        public:
+            TriangleBvh() {}
+            TriangleBvh(const Vector3D* vertices, size_t triangleCount, ThreadPool* pool = nullptr) { Build(vertices, triangleCount, pool); }
+
+            // vertices holds 3 * triangleCount points, one triangle per three consecutive vertices.
+            TriangleBvh& Build(const Vector3D* source, size_t triangleCount, ThreadPool* pool = nullptr) {
+                SetPrimitives(source, triangleCount);
+                Bvh::Build(pool);
+                return (*this);
+            }
+
+            // Non-indexed meshes only (mesh.indices == NULL), as produced by most GenMesh* functions.
+            TriangleBvh& Build(const ::Mesh& mesh, ThreadPool* pool = nullptr) {
+                return Build(reinterpret_cast<const Vector3D*>(mesh.vertices), static_cast<size_t>(mesh.vertexCount / 3), pool);
+            }
+
+            // Moved vertices of the same triangles (e.g. after skinning); keeps the tree topology.
+            TriangleBvh& Refit(const Vector3D* source) {
+                SetPrimitives(source, vertices.size() / 3);
+                RefitNodes();
+                return (*this);
+            }
+
+            bool IntersectPrimitive(uint32_t index, const ::Ray& ray, float limit, ::RayCollision& hit) const {
+                const float epsilon = 0.000001f;
+                const Vector3D& p1 = vertices[3 * index], & p2 = vertices[3 * index + 1], & p3 = vertices[3 * index + 2];
+                Vector3D origin = ray.position, direction = ray.direction;
+
+                Vector3D edge1 = p2 - p1, edge2 = p3 - p1;
+                Vector3D p = Vector3D(direction).CrossProduct(edge2);
+                float det = edge1.DotProduct(p);
+                if (det > -epsilon && det < epsilon) return false;
+
+                float invDet = 1.0f / det;
+                Vector3D tv = origin - p1;
+                float u = tv.DotProduct(p) * invDet;
+                if (u < 0.0f || u > 1.0f) return false;
+
+                Vector3D q = Vector3D(tv).CrossProduct(edge1);
+                float v = direction.DotProduct(q) * invDet;
+                if (v < 0.0f || u + v > 1.0f) return false;
+
+                float t = edge2.DotProduct(q) * invDet;
+                if (t <= epsilon || t >= limit) return false;
+
+                hit.hit = true, hit.distance = t;
+                hit.normal = Vector3D(edge1).CrossProduct(edge2).Normalize();
+                hit.point = origin + direction * t;
+                return true;
+            }
+        };
+    }
+}
+#endif
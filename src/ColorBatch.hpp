@@ -0,0 +1,253 @@
+/*
+    Bulk colour kernels over contiguous Colors (RGBA8) buffers: an image's pixels, a particle
+    buffer's tints. Each function is the array form of a Colors member and gives the same result
+    per pixel without a raylib call per pixel:
+
+        ToHsv / FromHsv         Colors::ToHsv / FromHsv (ColorToHSV / ColorFromHSV)
+        ToNormal / FromNormal   Colors::ToNormal / FromNormal (ColorNormalize / ColorFromNormalized)
+        Fade / Alpha            Colors::Fade / Alpha (Fade / ColorAlpha)
+        Blend                   Colors::Blend (ColorAlphaBlend, integer path)
+        SrgbToLinear            sRGB bytes -> linear floats, 256-entry table
+        LinearToSrgb            linear floats -> sRGB bytes, rounded to nearest via a 4096-entry table
+
+        std::vector<Vector4D> hsv(count);
+        ColorBatch::ToHsv(pixels, hsv.data(), count);
+        for (Vector4D& c : hsv) c.x = fmodf(c.x + 30.0f, 360.0f);
+        ColorBatch::FromHsv(hsv.data(), pixels, count);
+
+    Float results are Vector4D (the ColorVector layout) with alpha in w. Unlike Colors::FromHsv,
+    FromHsv keeps alpha from w so a ToHsv/FromHsv round trip preserves it. Byte results clamp to
+    [0, 255] and, except for LinearToSrgb, truncate as raylib does. The arithmetic kernels run
+    in simd::Batch lanes with RGBA8 lane loads/stores; the sRGB conversions are table lookups.
+    Every function takes an optional ThreadPool that splits arrays larger than parallelGrain.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_COLOR_BATCH
+#define RAYLIB_PLUSPLUS_COLOR_BATCH
+#include "./RaylibExtern.hpp"
+#include "./Colors.hpp"
+#include "./Vector.hpp"
+#include "./Simd.hpp"
+#include "./ThreadPool.hpp"
+#include <cmath>
+#include <cstdint>
+
+namespace raylib {
+    namespace cpp {
+        class ColorBatch {
+        private:
+            static_assert(sizeof(Colors) == 4, "Colors must be four packed bytes.");
+            static_assert(sizeof(Vector4D) == 4 * sizeof(float), "Vector4D must be four packed floats.");
+
+            template<typename F>
+            static void Run(size_t count, ThreadPool* pool, F&& body) {
+                if (pool && count >= 2 * parallelGrain) pool->ParallelFor(count, parallelGrain, body);
+                else body(size_t(0), count);
+            }
+
+            static const uint8_t* Bytes(const Colors* c) { return reinterpret_cast<const uint8_t*>(c); }
+            static uint8_t* Bytes(Colors* c) { return reinterpret_cast<uint8_t*>(c); }
+
+        public:
+            /*
+                sRGB tables, also used by Resampler's sRGB mode. decode[byte] is the linear value of an
+                sRGB byte. encode[i] is the nearest sRGB byte at the start of linear bucket
+                [i / 4096, (i + 1) / 4096); a bucket spans less than one byte step (the steepest part of
+                the curve is 12.92 * 255 / 4096 ~ 0.8 bytes), so the exact answer is encode[i] or
+                encode[i] + 1, settled by threshold[encode[i] + 1], the linear value where rounding moves
+                up to that byte.
+            */
+            struct SrgbTables {
+                float decode[256];
+                uint8_t encode[4096];
+                float threshold[257];
+
+                static double Decode(double c) { return c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4); }
+                static double Encode(double l) { return l <= 0.0031308 ? l * 12.92 : 1.055 * std::pow(l, 1.0 / 2.4) - 0.055; }
+
+                SrgbTables() {
+                    for (int i = 0; i < 256; i++)
+                        decode[i] = static_cast<float>(Decode(i / 255.0));
+                    threshold[0] = -1.0f, threshold[256] = 2.0f;
+                    for (int k = 1; k < 256; k++) {
+                        // Smallest float at or above the exact threshold, so the compare is exact too.
+                        double t = Decode((k - 0.5) / 255.0);
+                        threshold[k] = static_cast<float>(t);
+                        if (threshold[k] < t) threshold[k] = std::nextafter(threshold[k], 2.0f);
+                    }
+                    for (int i = 0; i < 4096; i++)
+                        encode[i] = static_cast<uint8_t>(std::floor(Encode(i / 4096.0) * 255.0 + 0.5));
+                }
+
+                uint8_t Quantize(float l) const {
+                    l = l > 0.0f ? (l < 1.0f ? l : 1.0f) : 0.0f;
+                    int bucket = static_cast<int>(l * 4096.0f);
+                    int c = encode[bucket < 4095 ? bucket : 4095];
+                    return static_cast<uint8_t>(c + (l >= threshold[c + 1] ? 1 : 0));
+                }
+            };
+
+            static const SrgbTables& Srgb() {
+                static const SrgbTables tables;
+                return tables;
+            }
+
+            // Arrays shorter than twice this many pixels are never split across a pool.
+            static constexpr size_t parallelGrain = 16384;
+
+            // (hue [0, 360), saturation [0, 1], value [0, 1], alpha [0, 1]). Grey pixels get hue 0.
+            static void ToHsv(const Colors* in, Vector4D* out, size_t count, ThreadPool* pool = nullptr) {
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    simd::Batch(end - begin, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        F r, g, b, a;
+                        simd::LoadRgba8(Bytes(in + begin + i), r, g, b, a);
+                        r = r / F(255.0f), g = g / F(255.0f), b = b / F(255.0f);
+
+                        F min = simd::Min(simd::Min(r, g), b), max = simd::Max(simd::Max(r, g), b);
+                        F delta = max - min;
+                        auto grey = delta < F(0.00001f);
+
+                        // Non-grey lanes have delta & max >= 0.00001, so the clamps only keep grey lanes finite.
+                        F d = simd::Max(delta, F(0.00001f));
+                        F hue = simd::Select(r >= max, (g - b) / d, simd::Select(g >= max, F(2.0f) + (b - r) / d, F(4.0f) + (r - g) / d)) * F(60.0f);
+                        hue = simd::Select(hue < F(0.0f), hue + F(360.0f), hue);
+                        F saturation = delta / simd::Max(max, F(0.00001f));
+
+                        float* p = &out[begin + i].x;
+                        simd::StoreStrided(simd::Select(grey, F(0.0f), hue), p, 4);
+                        simd::StoreStrided(simd::Select(grey, F(0.0f), saturation), p + 1, 4);
+                        simd::StoreStrided(max, p + 2, 4);
+                        simd::StoreStrided(a / F(255.0f), p + 3, 4);
+                    });
+                });
+            }
+
+            static void FromHsv(const Vector4D* in, Colors* out, size_t count, ThreadPool* pool = nullptr) {
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    simd::Batch(end - begin, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        const float* p = &in[begin + i].x;
+                        F hue = simd::LoadStrided<F>(p, 4), saturation = simd::LoadStrided<F>(p + 1, 4);
+                        F value = simd::LoadStrided<F>(p + 2, 4), alpha = simd::LoadStrided<F>(p + 3, 4);
+
+                        // ColorFromHSV per channel: k = fmodf(n + hue / 60, 6), clamped tent min(k, 4 - k).
+                        auto channel = [&](float n) {
+                            F k = F(n) + hue / F(60.0f);
+                            F whole = simd::Floor(simd::Abs(k) / F(6.0f)) * F(6.0f);
+                            k = k - simd::Select(k < F(0.0f), -whole, whole);
+                            k = simd::Max(simd::Min(simd::Min(k, F(4.0f) - k), F(1.0f)), F(0.0f));
+                            return (value - value * saturation * k) * F(255.0f);
+                        };
+                        simd::StoreRgba8(channel(5.0f), channel(3.0f), channel(1.0f), alpha * F(255.0f), Bytes(out + begin + i));
+                    });
+                });
+            }
+
+            static void ToNormal(const Colors* in, Vector4D* out, size_t count, ThreadPool* pool = nullptr) {
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    simd::Batch(end - begin, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        F r, g, b, a;
+                        simd::LoadRgba8(Bytes(in + begin + i), r, g, b, a);
+                        float* p = &out[begin + i].x;
+                        simd::StoreStrided(r / F(255.0f), p, 4);
+                        simd::StoreStrided(g / F(255.0f), p + 1, 4);
+                        simd::StoreStrided(b / F(255.0f), p + 2, 4);
+                        simd::StoreStrided(a / F(255.0f), p + 3, 4);
+                    });
+                });
+            }
+
+            static void FromNormal(const Vector4D* in, Colors* out, size_t count, ThreadPool* pool = nullptr) {
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    simd::Batch(end - begin, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        const float* p = &in[begin + i].x;
+                        simd::StoreRgba8(simd::LoadStrided<F>(p, 4) * F(255.0f), simd::LoadStrided<F>(p + 1, 4) * F(255.0f),
+                            simd::LoadStrided<F>(p + 2, 4) * F(255.0f), simd::LoadStrided<F>(p + 3, 4) * F(255.0f), Bytes(out + begin + i));
+                    });
+                });
+            }
+
+            // Sets every alpha to alpha * 255 (alpha clamped to [0, 1]), as Fade & ColorAlpha do.
+            static void Alpha(Colors* colors, size_t count, float alpha, ThreadPool* pool = nullptr) {
+                alpha = alpha < 0.0f ? 0.0f : (alpha > 1.0f ? 1.0f : alpha);
+                float a = static_cast<float>(static_cast<uint8_t>(255.0f * alpha));
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    simd::Batch(end - begin, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        F r, g, b, old;
+                        uint8_t* p = Bytes(colors + begin + i);
+                        simd::LoadRgba8(p, r, g, b, old);
+                        simd::StoreRgba8(r, g, b, F(a), p);
+                    });
+                });
+            }
+
+            static void Fade(Colors* colors, size_t count, float alpha, ThreadPool* pool = nullptr) { Alpha(colors, count, alpha, pool); }
+
+            /*
+                dest[i] = ColorAlphaBlend(dest[i], src[i], tint): src tinted, then drawn over dest. The
+                integer path divides by the blended alpha; here the quotient is estimated in float and
+                corrected by one step either way with exact integer-valued float compares, so the
+                result matches raylib bit for bit, except that channels raylib wraps past 255 (a near
+                transparent src over a near transparent dest) saturate instead.
+            */
+            static void Blend(const Colors* src, Colors* dest, size_t count, Colors tint, ThreadPool* pool = nullptr) {
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    simd::Batch(end - begin, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        F sc[4], dc[4];
+                        simd::LoadRgba8(Bytes(src + begin + i), sc[0], sc[1], sc[2], sc[3]);
+                        simd::LoadRgba8(Bytes(dest + begin + i), dc[0], dc[1], dc[2], dc[3]);
+
+                        const float t[4] = { tint.r + 1.0f, tint.g + 1.0f, tint.b + 1.0f, tint.a + 1.0f };
+                        for (int c = 0; c < 4; c++)
+                            sc[c] = simd::Floor(sc[c] * F(t[c]) * F(1.0f / 256.0f));
+
+                        F alpha = sc[3] + F(1.0f), inverse = F(256.0f) - alpha;
+                        F outA = alpha + simd::Floor(dc[3] * inverse * F(1.0f / 256.0f));
+                        auto clear = sc[3] == F(0.0f), opaque = sc[3] == F(255.0f);
+
+                        F o[4], reciprocal = F(1.0f) / outA;
+                        for (int c = 0; c < 3; c++) {
+                            // out = floor((s * alpha * 256 + d) / (outA * 256)) with d = dc * da * (256 - alpha) < 2^24.
+                            F s = sc[c] * alpha, d = dc[c] * dc[3] * inverse;
+                            F q = simd::Floor((s + d * F(1.0f / 256.0f)) * reciprocal);
+                            q = simd::Select(F(256.0f) * ((q + F(1.0f)) * outA - s) <= d, q + F(1.0f), q);
+                            q = simd::Select(F(256.0f) * (q * outA - s) > d, q - F(1.0f), q);
+                            o[c] = q;
+                        }
+                        o[3] = outA;
+
+                        for (int c = 0; c < 4; c++)
+                            o[c] = simd::Select(clear, dc[c], simd::Select(opaque, sc[c], o[c]));
+                        simd::StoreRgba8(o[0], o[1], o[2], o[3], Bytes(dest + begin + i));
+                    });
+                });
+            }
+
+            // rgb decoded from sRGB, alpha normalized as is.
+            static void SrgbToLinear(const Colors* in, Vector4D* out, size_t count, ThreadPool* pool = nullptr) {
+                const SrgbTables& tables = Srgb();
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++)
+                        out[i] = Vector4D(tables.decode[in[i].r], tables.decode[in[i].g], tables.decode[in[i].b], in[i].a / 255.0f);
+                });
+            }
+
+            // rgb encoded to sRGB and alpha scaled by 255, both clamped and rounded to nearest.
+            static void LinearToSrgb(const Vector4D* in, Colors* out, size_t count, ThreadPool* pool = nullptr) {
+                const SrgbTables& tables = Srgb();
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++) {
+                        float a = in[i].w > 0.0f ? (in[i].w < 1.0f ? in[i].w : 1.0f) : 0.0f;
+                        out[i] = Colors(tables.Quantize(in[i].x), tables.Quantize(in[i].y), tables.Quantize(in[i].z), static_cast<byte>(a * 255.0f + 0.5f));
+                    }
+                });
+            }
+        };
+    }
+}
+#endif
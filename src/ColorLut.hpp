@@ -0,0 +1,241 @@
+/*
+    3D colour lookup table for grading RGBA8 pixels in one pass.
+
+    A ColorLut3D holds size^3 RGB entries over the input cube [domainMin, domainMax] (red fastest,
+    as in .cube files). It can be loaded from an Adobe/Resolve .cube file or built by chaining the
+    same operations Image offers, applied to every entry once instead of to every pixel:
+
+        ColorLut3D grade;
+        grade.Contrast(20.0f).Brightness(-10).Tint(Colors(255, 240, 220, 255));
+        image.ColorGrade(grade, &pool);
+
+    Contrast, Brightness, Tint, Invert & Grayscale follow ImageColorContrast/Brightness/Tint/Invert/
+    Grayscale on continuous values (no per-step rounding), and Map takes any Vector3D -> Vector3D
+    function of normalized RGB. The table only covers RGB, so alpha passes through (unlike
+    ImageColorTint, Tint does not scale alpha).
+
+    Apply interpolates trilinearly in simd::Batch lanes, reading table corners with simd::Gather
+    (a hardware gather under AVX2). It splits across a ThreadPool when one is given.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_COLOR_LUT
+#define RAYLIB_PLUSPLUS_COLOR_LUT
+#include "./RaylibExtern.hpp"
+#include "./Colors.hpp"
+#include "./ImageView.hpp"
+#include "./Vector.hpp"
+#include "./Simd.hpp"
+#include "./ThreadPool.hpp"
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace raylib {
+    namespace cpp {
+        class ColorLut3D {
+        private:
+            int size = 0;
+            std::vector<float> r, g, b;
+
+            template<typename F>
+            static void Run(size_t count, ThreadPool* pool, F&& body) {
+                if (pool && count >= 2 * parallelGrain) pool->ParallelFor(count, parallelGrain, body);
+                else body(size_t(0), count);
+            }
+
+            static float Clamp01(float v) { return v < 0.0f ? 0.0f : (v > 1.0f ? 1.0f : v); }
+
+        public:
+            // Pixels per pool task.
+            static constexpr size_t parallelGrain = 16384;
+
+            Vector3D domainMin = Vector3D(0.0f, 0.0f, 0.0f), domainMax = Vector3D(1.0f, 1.0f, 1.0f);
+
+            // Identity table; 33 entries per axis is the common size for .cube grading LUTs.
+            ColorLut3D(int size = 33) { Identity(size); }
+
+            int Size() const { return size; }
+
+            Vector3D Get(int x, int y, int z) const {
+                size_t i = size_t(x) + size_t(size) * (size_t(y) + size_t(size) * size_t(z));
+                return Vector3D(r[i], g[i], b[i]);
+            }
+
+            void Set(int x, int y, int z, Vector3D color) {
+                size_t i = size_t(x) + size_t(size) * (size_t(y) + size_t(size) * size_t(z));
+                r[i] = color.x, g[i] = color.y, b[i] = color.z;
+            }
+
+            ColorLut3D& Identity(int size) {
+                this->size = size < 2 ? 2 : size;
+                size_t count = size_t(this->size) * this->size * this->size;
+                r.resize(count), g.resize(count), b.resize(count);
+                domainMin = Vector3D(0.0f, 0.0f, 0.0f), domainMax = Vector3D(1.0f, 1.0f, 1.0f);
+
+                float step = 1.0f / float(this->size - 1);
+                for (int z = 0; z < this->size; z++)
+                    for (int y = 0; y < this->size; y++)
+                        for (int x = 0; x < this->size; x++)
+                            Set(x, y, z, Vector3D(x * step, y * step, z * step));
+                return (*this);
+            }
+
+            // Replaces every entry c with transform(c), c being normalized RGB.
+            template<typename Transform>
+            ColorLut3D& Map(Transform&& transform) {
+                for (size_t i = 0; i < r.size(); i++) {
+                    Vector3D c = transform(Vector3D(r[i], g[i], b[i]));
+                    r[i] = c.x, g[i] = c.y, b[i] = c.z;
+                }
+                return (*this);
+            }
+
+            // contrast in [-100, 100], as ImageColorContrast.
+            ColorLut3D& Contrast(float contrast) {
+                contrast = contrast < -100.0f ? -100.0f : (contrast > 100.0f ? 100.0f : contrast);
+                contrast = (100.0f + contrast) / 100.0f;
+                contrast *= contrast;
+                return Map([&](Vector3D c) {
+                    return Vector3D(Clamp01((c.x - 0.5f) * contrast + 0.5f), Clamp01((c.y - 0.5f) * contrast + 0.5f), Clamp01((c.z - 0.5f) * contrast + 0.5f));
+                });
+            }
+
+            // brightness in [-255, 255], as ImageColorBrightness.
+            ColorLut3D& Brightness(int brightness) {
+                float offset = (brightness < -255 ? -255 : (brightness > 255 ? 255 : brightness)) / 255.0f;
+                return Map([&](Vector3D c) { return Vector3D(Clamp01(c.x + offset), Clamp01(c.y + offset), Clamp01(c.z + offset)); });
+            }
+
+            ColorLut3D& Tint(Colors tint) {
+                float tr = tint.r / 255.0f, tg = tint.g / 255.0f, tb = tint.b / 255.0f;
+                return Map([&](Vector3D c) { return Vector3D(c.x * tr, c.y * tg, c.z * tb); });
+            }
+
+            ColorLut3D& Invert() {
+                return Map([](Vector3D c) { return Vector3D(1.0f - c.x, 1.0f - c.y, 1.0f - c.z); });
+            }
+
+            // Same weights as ImageColorGrayscale (via ImageFormat's grayscale conversion).
+            ColorLut3D& Grayscale() {
+                return Map([](Vector3D c) {
+                    float v = c.x * 0.299f + c.y * 0.587f + c.z * 0.114f;
+                    return Vector3D(v, v, v);
+                });
+            }
+
+            /*
+                Parses .cube text: LUT_3D_SIZE, optional DOMAIN_MIN/DOMAIN_MAX and TITLE, '#' comments,
+                then size^3 "r g b" rows with red changing fastest. Returns false (leaving the table
+                unchanged) for 1D LUTs, missing or extra rows, or malformed lines.
+            */
+            bool LoadCubeFromMemory(const char* text) {
+                if (text == nullptr) return false;
+                std::istringstream stream(text);
+                std::string line;
+                int cubeSize = 0;
+                Vector3D min(0.0f, 0.0f, 0.0f), max(1.0f, 1.0f, 1.0f);
+                std::vector<float> values;
+
+                while (std::getline(stream, line)) {
+                    size_t start = line.find_first_not_of(" \t\r");
+                    if (start == std::string::npos || line[start] == '#') continue;
+
+                    std::istringstream fields(line.substr(start));
+                    std::string key;
+                    if (line.compare(start, 5, "TITLE") == 0) continue;
+                    if (line.compare(start, 11, "LUT_1D_SIZE") == 0) return false;
+                    if (line.compare(start, 11, "LUT_3D_SIZE") == 0) {
+                        if (!(fields >> key >> cubeSize) || cubeSize < 2 || cubeSize > 256) return false;
+                        values.reserve(size_t(cubeSize) * cubeSize * cubeSize * 3);
+                        continue;
+                    }
+                    if (line.compare(start, 10, "DOMAIN_MIN") == 0) {
+                        if (!(fields >> key >> min.x >> min.y >> min.z)) return false;
+                        continue;
+                    }
+                    if (line.compare(start, 10, "DOMAIN_MAX") == 0) {
+                        if (!(fields >> key >> max.x >> max.y >> max.z)) return false;
+                        continue;
+                    }
+
+                    float v[3];
+                    if (!(fields >> v[0] >> v[1] >> v[2])) return false;
+                    values.insert(values.end(), v, v + 3);
+                }
+
+                size_t count = size_t(cubeSize) * cubeSize * cubeSize;
+                if (cubeSize == 0 || values.size() != count * 3 || !(max.x > min.x && max.y > min.y && max.z > min.z)) return false;
+
+                size = cubeSize, domainMin = min, domainMax = max;
+                r.resize(count), g.resize(count), b.resize(count);
+                for (size_t i = 0; i < count; i++)
+                    r[i] = values[i * 3], g[i] = values[i * 3 + 1], b[i] = values[i * 3 + 2];
+                return true;
+            }
+
+            // Loads through raylib's LoadFileText, so custom file callbacks apply.
+            bool LoadCube(const char* fileName) {
+                char* text = ::LoadFileText(fileName);
+                bool loaded = LoadCubeFromMemory(text);
+                if (text) ::UnloadFileText(text);
+                return loaded;
+            }
+
+            // Grades pixels in place: RGB through the table (trilinear, rounded to nearest), alpha unchanged.
+            void Apply(Colors* pixels, size_t count, ThreadPool* pool = nullptr) const {
+                const float last = float(size - 1);
+                const float scale[3] = { last / (255.0f * (domainMax.x - domainMin.x)), last / (255.0f * (domainMax.y - domainMin.y)), last / (255.0f * (domainMax.z - domainMin.z)) };
+                const float offset[3] = { -domainMin.x * last / (domainMax.x - domainMin.x), -domainMin.y * last / (domainMax.y - domainMin.y), -domainMin.z * last / (domainMax.z - domainMin.z) };
+                const float* tables[3] = { r.data(), g.data(), b.data() };
+                const float strideY = float(size), strideZ = float(size) * float(size);
+
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    simd::Batch(end - begin, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        uint8_t* p = reinterpret_cast<uint8_t*>(pixels + begin + i);
+                        F c[4];
+                        simd::LoadRgba8(p, c[0], c[1], c[2], c[3]);
+
+                        // Table coordinate per axis: lower corner index, its +1 neighbour (clamped) & weight.
+                        F base[3], next[3], weight[3];
+                        const float strides[3] = { 1.0f, strideY, strideZ };
+                        for (int k = 0; k < 3; k++) {
+                            F u = simd::Min(simd::Max(c[k] * F(scale[k]) + F(offset[k]), F(0.0f)), F(last));
+                            F lower = simd::Min(simd::Floor(u), F(last - 1.0f));
+                            weight[k] = u - lower;
+                            base[k] = lower * F(strides[k]), next[k] = F(strides[k]);
+                        }
+
+                        F corner = base[0] + base[1] + base[2];
+                        for (int k = 0; k < 3; k++) {
+                            const float* t = tables[k];
+                            auto at = [&](F index) { return simd::Gather(t, index); };
+                            F c00 = at(corner), c10 = at(corner + next[0]);
+                            F c01 = at(corner + next[1]), c11 = at(corner + next[0] + next[1]);
+                            F zc = corner + next[2];
+                            F d00 = at(zc), d10 = at(zc + next[0]);
+                            F d01 = at(zc + next[1]), d11 = at(zc + next[0] + next[1]);
+
+                            F x0 = c00 + (c10 - c00) * weight[0], x1 = c01 + (c11 - c01) * weight[0];
+                            F x2 = d00 + (d10 - d00) * weight[0], x3 = d01 + (d11 - d01) * weight[0];
+                            F y0 = x0 + (x1 - x0) * weight[1], y1 = x2 + (x3 - x2) * weight[1];
+                            c[k] = simd::Floor((y0 + (y1 - y0) * weight[2]) * F(255.0f) + F(0.5f));
+                        }
+                        simd::StoreRgba8(c[0], c[1], c[2], c[3], p);
+                    });
+                });
+            }
+
+            // RGBA8 views only; rows are split across the pool in parallelGrain-sized ranges.
+            void Apply(const ImageView& view, ThreadPool* pool = nullptr) const {
+                if (view.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 || view.Empty()) return;
+                if (view.Contiguous()) return Apply(view.Row<Colors>(0), size_t(view.width) * size_t(view.height), pool);
+                view.ForRows(pool, parallelGrain, [&](size_t begin, size_t end) {
+                    for (size_t y = begin; y < end; y++) Apply(view.Row<Colors>(int(y)), size_t(view.width));
+                });
+            }
+        };
+    }
+}
+#endif
@@ -0,0 +1,379 @@
+/*
+    Palette quantization and remapping for RGBA8 pixel buffers (indexed-colour export, retro looks).
+
+    ColorPalette::Build reduces pixels to at most maxColors entries. If the pixels have few enough
+    distinct colours they are used as they are; otherwise the palette comes from a median cut over
+    a 32x32x32 RGB histogram, each entry being the mean colour of its box. The histogram is filled
+    in parallel bands when a ThreadPool is given.
+
+        ColorPalette palette = ColorPalette::Build(pixels, width * height, 16, &pool);
+        std::vector<uint8_t> indices(width * height);
+        palette.Remap(pixels, width, height, indices.data(), PaletteDither::Ordered, &pool);
+
+    Alpha is binary, as in GIF: pixels with alpha below alphaThreshold take a single transparent
+    entry (index 0, {0, 0, 0, 0}) and all other pixels are matched on RGB against the opaque entries.
+    With maxColors == 1 and opaque pixels present there is no room for it: the one entry is opaque
+    and transparent pixels map to it.
+    A palette constructed from a colour list treats entries below alphaThreshold the same way.
+
+    Nearest-colour lookup is exact (squared RGB distance, lowest index on ties) without scanning the
+    whole palette: each cell of a 16x16x16 grid keeps the entries that can be nearest to some colour
+    inside it, which is a handful even for 256-entry palettes.
+
+    Dithering: Ordered adds an 8x8 Bayer offset scaled to the palette spacing (255 / cbrt(entries))
+    and, like PaletteDither::None, runs rows in parallel. FloydSteinberg diffuses the error in
+    serpentine order; each row depends on the previous one, so it runs serially.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_COLOR_PALETTE
+#define RAYLIB_PLUSPLUS_COLOR_PALETTE
+#include "./RaylibExtern.hpp"
+#include "./Colors.hpp"
+#include "./ImageView.hpp"
+#include "./ThreadPool.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace raylib {
+    namespace cpp {
+        enum class PaletteDither { None, Ordered, FloydSteinberg };
+
+        class ColorPalette {
+        private:
+            static constexpr int cellBits = 4, cells = 1 << cellBits, cellShift = 8 - cellBits;
+            static constexpr int binBits = 5, bins = 1 << (3 * binBits), binShift = 8 - binBits;
+
+            std::vector<Colors> entries;
+            std::vector<uint32_t> cellStart;  // cells^3 + 1 offsets into candidates.
+            std::vector<uint32_t> candidates; // distance to the cell << 8 | entry, ascending.
+            int transparent = -1;
+            float spread = 0.0f;
+
+            struct Bin {
+                uint64_t r = 0, g = 0, b = 0;
+                uint32_t count = 0, color = 0;
+                bool mixed = false;
+            };
+
+            struct Box {
+                int lo[3], hi[3];
+                uint64_t count;
+            };
+
+            static int Clamp(int v) { return v < 0 ? 0 : (v > 255 ? 255 : v); }
+
+            static int BinIndex(int r, int g, int b) {
+                return (r >> binShift) | (g >> binShift) << binBits | (b >> binShift) << (2 * binBits);
+            }
+
+            // Grid of candidate lists: an entry is kept for a cell if its distance to the cell's box
+            // is no more than the smallest farthest-point distance of any entry. Lists are sorted by
+            // that distance so a search can stop once no later entry can be closer.
+            void Index() {
+                transparent = -1;
+                std::vector<int> opaque;
+                for (size_t i = 0; i < entries.size(); i++) {
+                    if (entries[i].a >= alphaThreshold) opaque.push_back(int(i));
+                    else if (transparent < 0) transparent = int(i);
+                }
+                spread = opaque.empty() ? 0.0f : 255.0f / std::cbrt(float(opaque.size()));
+
+                cellStart.assign(size_t(cells) * cells * cells + 1, 0);
+                candidates.clear();
+                std::vector<int> nearest(opaque.size());
+                for (int cell = 0; cell < cells * cells * cells; cell++) {
+                    int lo[3] = { (cell & (cells - 1)) << cellShift, ((cell >> cellBits) & (cells - 1)) << cellShift, (cell >> (2 * cellBits)) << cellShift };
+                    int bound = INT_MAX;
+                    for (size_t j = 0; j < opaque.size(); j++) {
+                        const Colors& e = entries[opaque[j]];
+                        int v[3] = { e.r, e.g, e.b }, near = 0, far = 0;
+                        for (int k = 0; k < 3; k++) {
+                            int hi = lo[k] + (1 << cellShift) - 1;
+                            int d = v[k] < lo[k] ? lo[k] - v[k] : (v[k] > hi ? v[k] - hi : 0);
+                            int f = v[k] - lo[k] > hi - v[k] ? v[k] - lo[k] : hi - v[k];
+                            near += d * d, far += f * f;
+                        }
+                        nearest[j] = near;
+                        if (far < bound) bound = far;
+                    }
+                    size_t first = candidates.size();
+                    for (size_t j = 0; j < opaque.size(); j++)
+                        if (nearest[j] <= bound) candidates.push_back(uint32_t(nearest[j]) << 8 | uint32_t(opaque[j]));
+                    std::sort(candidates.begin() + first, candidates.end());
+                    cellStart[cell + 1] = uint32_t(candidates.size());
+                }
+            }
+
+            int NearestOpaque(int r, int g, int b) const {
+                int cell = (r >> cellShift) | (g >> cellShift) << cellBits | (b >> cellShift) << (2 * cellBits);
+                int best = -1, bestDistance = INT_MAX;
+                for (uint32_t k = cellStart[cell]; k < cellStart[cell + 1]; k++) {
+                    if (int(candidates[k] >> 8) > bestDistance) break;
+                    int index = int(candidates[k] & 0xFF);
+                    const Colors& e = entries[index];
+                    int dr = r - e.r, dg = g - e.g, db = b - e.b;
+                    int d = dr * dr + dg * dg + db * db;
+                    if (d < bestDistance || (d == bestDistance && index < best)) bestDistance = d, best = index;
+                }
+                return best >= 0 ? best : (transparent >= 0 ? transparent : 0);
+            }
+
+            bool Transparent(Colors c) const { return c.a < alphaThreshold && transparent >= 0; }
+
+            // Calls out(x, y, entry) for every pixel of a width x height buffer whose rows are stride pixels apart.
+            template<typename Out>
+            void Process(const Colors* src, size_t stride, int width, int height, PaletteDither dither, ThreadPool* pool, Out&& out) const {
+                if (src == nullptr || entries.empty() || width <= 0 || height <= 0) return;
+
+                if (dither == PaletteDither::FloydSteinberg) {
+                    // Errors in 1/16ths, one pixel of padding at each end of the row.
+                    std::vector<int> error[2] = { std::vector<int>((size_t(width) + 2) * 3), std::vector<int>((size_t(width) + 2) * 3) };
+                    for (int y = 0; y < height; y++) {
+                        std::vector<int>& current = error[y & 1];
+                        std::vector<int>& next = error[(y + 1) & 1];
+                        std::fill(next.begin(), next.end(), 0);
+                        const Colors* row = src + size_t(y) * stride;
+                        int dir = (y & 1) ? -1 : 1;
+                        for (int step = 0; step < width; step++) {
+                            int x = dir > 0 ? step : width - 1 - step;
+                            if (Transparent(row[x])) {
+                                out(x, y, transparent);
+                                continue;
+                            }
+
+                            const int* e = &current[(size_t(x) + 1) * 3];
+                            int v[3] = { Clamp(row[x].r + ((e[0] + 8) >> 4)), Clamp(row[x].g + ((e[1] + 8) >> 4)), Clamp(row[x].b + ((e[2] + 8) >> 4)) };
+                            int index = NearestOpaque(v[0], v[1], v[2]);
+                            const Colors& p = entries[index];
+                            int d[3] = { v[0] - p.r, v[1] - p.g, v[2] - p.b };
+                            for (int k = 0; k < 3; k++) {
+                                current[(size_t(x + 1 + dir)) * 3 + k] += d[k] * 7;
+                                next[(size_t(x + 1 - dir)) * 3 + k] += d[k] * 3;
+                                next[(size_t(x + 1)) * 3 + k] += d[k] * 5;
+                                next[(size_t(x + 1 + dir)) * 3 + k] += d[k];
+                            }
+                            out(x, y, index);
+                        }
+                    }
+                    return;
+                }
+
+                static const uint8_t bayer[64] = {
+                     0, 32,  8, 40,  2, 34, 10, 42,
+                    48, 16, 56, 24, 50, 18, 58, 26,
+                    12, 44,  4, 36, 14, 46,  6, 38,
+                    60, 28, 52, 20, 62, 30, 54, 22,
+                     3, 35, 11, 43,  1, 33,  9, 41,
+                    51, 19, 59, 27, 49, 17, 57, 25,
+                    15, 47,  7, 39, 13, 45,  5, 37,
+                    63, 31, 55, 23, 61, 29, 53, 21,
+                };
+                int offset[64] = {};
+                if (dither == PaletteDither::Ordered)
+                    for (int i = 0; i < 64; i++) offset[i] = int(std::lround(((bayer[i] + 0.5f) / 64.0f - 0.5f) * spread));
+
+                auto body = [&](size_t begin, size_t end) {
+                    for (size_t y = begin; y < end; y++) {
+                        const Colors* row = src + y * stride;
+                        const int* o = offset + (y & 7) * 8;
+                        for (int x = 0; x < width; x++) {
+                            Colors c = row[x];
+                            int d = o[x & 7];
+                            out(x, int(y), Transparent(c) ? transparent : NearestOpaque(Clamp(c.r + d), Clamp(c.g + d), Clamp(c.b + d)));
+                        }
+                    }
+                };
+                if (pool && height >= 2 * parallelRows) pool->ParallelFor(size_t(height), size_t(parallelRows), body);
+                else body(0, size_t(height));
+            }
+
+        public:
+            // Pixels below this alpha map to the transparent entry.
+            static constexpr unsigned char alphaThreshold = 128;
+            // Rows per pool task for Remap/Apply, pixels per histogram band for Build.
+            static constexpr int parallelRows = 16;
+            static constexpr size_t parallelGrain = 65536;
+
+            ColorPalette() = default;
+
+            // At most 256 colours are kept, so entries fit 8-bit indices.
+            ColorPalette(const Colors* colors, size_t count) : entries(colors, colors + (count < 256 ? count : 256)) { Index(); }
+            explicit ColorPalette(const std::vector<Colors>& colors) : ColorPalette(colors.data(), colors.size()) {}
+
+            size_t Count() const { return entries.size(); }
+            const Colors* Data() const { return entries.data(); }
+            Colors operator[](size_t index) const { return entries[index]; }
+
+            // Index of the entry a pixel maps to without dithering.
+            int Nearest(Colors color) const {
+                if (entries.empty()) return -1;
+                return Transparent(color) ? transparent : NearestOpaque(color.r, color.g, color.b);
+            }
+
+            static ColorPalette Build(const Colors* pixels, size_t count, int maxColors = 256, ThreadPool* pool = nullptr) {
+                maxColors = maxColors < 1 ? 1 : (maxColors > 256 ? 256 : maxColors);
+                if (pixels == nullptr || count == 0) return ColorPalette();
+
+                // Per-band histograms, merged afterwards; a bin remembers its colour while it only holds one.
+                size_t bands = 1;
+                if (pool && count >= 2 * parallelGrain) {
+                    bands = pool->Size() + 1;
+                    if (bands > count / parallelGrain) bands = count / parallelGrain;
+                }
+                std::vector<std::vector<Bin>> histograms(bands, std::vector<Bin>(bins));
+                std::vector<uint8_t> transparentSeen(bands, 0);
+                auto fill = [&](size_t band) {
+                    std::vector<Bin>& h = histograms[band];
+                    for (size_t i = count * band / bands, end = count * (band + 1) / bands; i < end; i++) {
+                        Colors c = pixels[i];
+                        if (c.a < alphaThreshold) {
+                            transparentSeen[band] = 1;
+                            continue;
+                        }
+                        Bin& bin = h[BinIndex(c.r, c.g, c.b)];
+                        uint32_t rgb = uint32_t(c.r) | uint32_t(c.g) << 8 | uint32_t(c.b) << 16;
+                        if (bin.count == 0) bin.color = rgb;
+                        else if (bin.color != rgb) bin.mixed = true;
+                        bin.count++, bin.r += c.r, bin.g += c.g, bin.b += c.b;
+                    }
+                };
+                if (bands > 1) pool->ParallelFor(bands, 1, [&](size_t begin, size_t end) { for (size_t b = begin; b < end; b++) fill(b); });
+                else fill(0);
+
+                std::vector<Bin>& h = histograms[0];
+                bool anyTransparent = transparentSeen[0] != 0;
+                for (size_t band = 1; band < bands; band++) {
+                    anyTransparent |= transparentSeen[band] != 0;
+                    for (int i = 0; i < bins; i++) {
+                        const Bin& o = histograms[band][i];
+                        if (o.count == 0) continue;
+                        if (h[i].count == 0) h[i].color = o.color;
+                        h[i].mixed |= o.mixed || o.color != h[i].color;
+                        h[i].count += o.count, h[i].r += o.r, h[i].g += o.g, h[i].b += o.b;
+                    }
+                }
+
+                int used = 0;
+                bool mixed = false;
+                for (int i = 0; i < bins; i++)
+                    if (h[i].count) used++, mixed |= h[i].mixed;
+
+                // The transparent entry needs a slot of its own; with a single slot and opaque pixels the
+                // slot goes to the opaque colour and transparent pixels map to it.
+                std::vector<Colors> colors;
+                if (anyTransparent && (maxColors >= 2 || used == 0)) colors.push_back(Colors(0, 0, 0, 0));
+                int budget = maxColors - int(colors.size());
+                if (budget <= 0 || used == 0) return ColorPalette(colors);
+
+                if (used <= budget) {
+                    // Few enough bins: keep the exact colours if there are no more than budget of them.
+                    std::vector<uint32_t> distinct;
+                    if (!mixed) {
+                        for (int i = 0; i < bins; i++)
+                            if (h[i].count) distinct.push_back(h[i].color);
+                    } else {
+                        uint32_t last = UINT32_MAX;
+                        for (size_t i = 0; i < count && int(distinct.size()) <= budget; i++) {
+                            Colors c = pixels[i];
+                            uint32_t rgb = uint32_t(c.r) | uint32_t(c.g) << 8 | uint32_t(c.b) << 16;
+                            if (c.a < alphaThreshold || rgb == last) continue;
+                            last = rgb;
+                            auto at = std::lower_bound(distinct.begin(), distinct.end(), rgb);
+                            if (at == distinct.end() || *at != rgb) distinct.insert(at, rgb);
+                        }
+                    }
+                    if (int(distinct.size()) <= budget) {
+                        for (uint32_t rgb : distinct) colors.push_back(Colors(rgb & 0xFF, (rgb >> 8) & 0xFF, (rgb >> 16) & 0xFF, 255));
+                        return ColorPalette(colors);
+                    }
+                }
+
+                // Median cut: split the box with the largest count x longest side at the weighted median.
+                auto bin = [&](int x, int y, int z) -> const Bin& { return h[x | y << binBits | z << (2 * binBits)]; };
+                auto shrink = [&](Box& box) {
+                    int lo[3] = { 31, 31, 31 }, hi[3] = { 0, 0, 0 };
+                    box.count = 0;
+                    for (int z = box.lo[2]; z <= box.hi[2]; z++)
+                        for (int y = box.lo[1]; y <= box.hi[1]; y++)
+                            for (int x = box.lo[0]; x <= box.hi[0]; x++) {
+                                if (bin(x, y, z).count == 0) continue;
+                                int p[3] = { x, y, z };
+                                for (int k = 0; k < 3; k++) lo[k] = p[k] < lo[k] ? p[k] : lo[k], hi[k] = p[k] > hi[k] ? p[k] : hi[k];
+                                box.count += bin(x, y, z).count;
+                            }
+                    for (int k = 0; k < 3; k++) box.lo[k] = lo[k], box.hi[k] = hi[k];
+                };
+
+                std::vector<Box> boxes(1, Box { { 0, 0, 0 }, { 31, 31, 31 }, 0 });
+                shrink(boxes[0]);
+                while (int(boxes.size()) < budget) {
+                    int best = -1, axis = 0;
+                    uint64_t bestScore = 0;
+                    for (size_t i = 0; i < boxes.size(); i++) {
+                        int a = 0;
+                        for (int k = 1; k < 3; k++)
+                            if (boxes[i].hi[k] - boxes[i].lo[k] > boxes[i].hi[a] - boxes[i].lo[a]) a = k;
+                        uint64_t score = boxes[i].count * uint64_t(boxes[i].hi[a] - boxes[i].lo[a]);
+                        if (score > bestScore) bestScore = score, best = int(i), axis = a;
+                    }
+                    if (best < 0) break;
+
+                    Box& box = boxes[best];
+                    std::vector<uint64_t> slices(32, 0);
+                    for (int z = box.lo[2]; z <= box.hi[2]; z++)
+                        for (int y = box.lo[1]; y <= box.hi[1]; y++)
+                            for (int x = box.lo[0]; x <= box.hi[0]; x++) {
+                                int p[3] = { x, y, z };
+                                slices[p[axis]] += bin(x, y, z).count;
+                            }
+                    int cut = box.lo[axis];
+                    for (uint64_t sum = slices[cut]; cut < box.hi[axis] - 1 && sum * 2 < box.count; sum += slices[++cut]) {}
+
+                    Box upper = box;
+                    box.hi[axis] = cut, upper.lo[axis] = cut + 1;
+                    shrink(box), shrink(upper);
+                    boxes.push_back(upper);
+                }
+
+                for (const Box& box : boxes) {
+                    uint64_t r = 0, g = 0, b = 0;
+                    for (int z = box.lo[2]; z <= box.hi[2]; z++)
+                        for (int y = box.lo[1]; y <= box.hi[1]; y++)
+                            for (int x = box.lo[0]; x <= box.hi[0]; x++) {
+                                const Bin& o = bin(x, y, z);
+                                r += o.r, g += o.g, b += o.b;
+                            }
+                    colors.push_back(Colors((r + box.count / 2) / box.count, (g + box.count / 2) / box.count, (b + box.count / 2) / box.count, 255));
+                }
+                return ColorPalette(colors);
+            }
+
+            // Writes one palette index per pixel.
+            void Remap(const Colors* src, int width, int height, uint8_t* indices, PaletteDither dither = PaletteDither::None, ThreadPool* pool = nullptr) const {
+                Process(src, size_t(width), width, height, dither, pool, [&](int x, int y, int index) { indices[size_t(y) * width + x] = uint8_t(index); });
+            }
+
+            // Replaces every pixel with its palette colour, in place.
+            void Apply(Colors* pixels, int width, int height, PaletteDither dither = PaletteDither::None, ThreadPool* pool = nullptr) const {
+                Process(pixels, size_t(width), width, height, dither, pool, [&](int x, int y, int index) { pixels[size_t(y) * width + x] = entries[index]; });
+            }
+
+            // RGBA8 views only; indices are written tightly packed, width per row.
+            void Remap(const ImageView& view, uint8_t* indices, PaletteDither dither = PaletteDither::None, ThreadPool* pool = nullptr) const {
+                if (view.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 || view.Empty()) return;
+                Process(view.Row<const Colors>(0), view.stride / sizeof(Colors), view.width, view.height, dither, pool,
+                    [&](int x, int y, int index) { indices[size_t(y) * view.width + x] = uint8_t(index); });
+            }
+
+            void Apply(const ImageView& view, PaletteDither dither = PaletteDither::None, ThreadPool* pool = nullptr) const {
+                if (view.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 || view.Empty()) return;
+                Process(view.Row<const Colors>(0), view.stride / sizeof(Colors), view.width, view.height, dither, pool,
+                    [&](int x, int y, int index) { view.Row<Colors>(y)[x] = entries[index]; });
+            }
+        };
+    }
+}
+#endif
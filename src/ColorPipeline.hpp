@@ -0,0 +1,168 @@
+/*
+    Deferred per-pixel colour operations, fused into one pass over an RGBA8 buffer.
+
+    Each Image::Color* call (ColorTint, ColorContrast, ...) is a separate raylib pass that copies the
+    image and walks every pixel again. A ColorPipeline records the operations instead and applies them
+    all while a group of pixels is in SIMD registers, so the pixels are read and written once:
+
+        image.Pipeline(&pool).Tint(Colors(255, 200, 180, 255)).Contrast(25.0f).Brightness(-10).Apply();
+
+        ColorPipeline fade;
+        fade.Grayscale().AlphaPremultiply();
+        fade.Apply(pixels, count, &pool);
+
+    Every step gives the same bytes as its raylib function, including raylib's truncation to a
+    byte after each step, so a fused chain matches the chain of Image calls. The exceptions:
+        - Grayscale writes the grey value to R, G and B and keeps alpha. ImageColorGrayscale instead
+          changes the image format to PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, which drops alpha.
+        - As with ColorBatch, results can differ in the last bit when the compiler contracts
+          multiply-adds into FMA (-mfma).
+
+    A pipeline from Image::Pipeline applies to that image and must not outlive it. Non-RGBA8 images
+    are converted to RGBA8 and back, as the raylib functions do.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_COLOR_PIPELINE
+#define RAYLIB_PLUSPLUS_COLOR_PIPELINE
+#include "./RaylibExtern.hpp"
+#include "./Colors.hpp"
+#include "./ImageView.hpp"
+#include "./Simd.hpp"
+#include "./ThreadPool.hpp"
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+namespace raylib {
+    namespace cpp {
+        class ColorPipeline {
+        private:
+            enum class Op : uint8_t { Tint, Contrast, Brightness, Invert, Grayscale, Replace, AlphaPremultiply };
+
+            struct Step {
+                Op op;
+                float value[8];
+            };
+
+            std::vector<Step> steps;
+            std::function<void(const ColorPipeline&)> target;
+
+            ColorPipeline& Add(Op op, std::initializer_list<float> values = {}) {
+                Step step { op, {} };
+                int i = 0;
+                for (float v : values) step.value[i++] = v;
+                steps.push_back(step);
+                return (*this);
+            }
+
+            template<typename F>
+            static F Clamp255(F v) { return simd::Min(simd::Max(v, F(0.0f)), F(255.0f)); }
+
+            template<typename F>
+            void Run(F c[4]) const {
+                for (const Step& s : steps) {
+                    switch (s.op) {
+                        case Op::Tint:
+                            for (int k = 0; k < 4; k++) c[k] = simd::Floor(c[k] / F(255.0f) * F(s.value[k]) * F(255.0f));
+                            break;
+                        case Op::Contrast:
+                            for (int k = 0; k < 3; k++) c[k] = simd::Floor(Clamp255(((c[k] / F(255.0f) - F(0.5f)) * F(s.value[0]) + F(0.5f)) * F(255.0f)));
+                            break;
+                        case Op::Brightness:
+                            for (int k = 0; k < 3; k++) c[k] = Clamp255(c[k] + F(s.value[0]));
+                            break;
+                        case Op::Invert:
+                            for (int k = 0; k < 3; k++) c[k] = F(255.0f) - c[k];
+                            break;
+                        case Op::Grayscale:
+                            // ImageFormat's grayscale conversion from normalized channels.
+                            c[0] = c[1] = c[2] = simd::Floor((c[0] / F(255.0f) * F(0.299f) + c[1] / F(255.0f) * F(0.587f) + c[2] / F(255.0f) * F(0.114f)) * F(255.0f));
+                            break;
+                        case Op::Replace: {
+                            auto match = (c[0] == F(s.value[0])) & (c[1] == F(s.value[1])) & (c[2] == F(s.value[2])) & (c[3] == F(s.value[3]));
+                            for (int k = 0; k < 4; k++) c[k] = simd::Select(match, F(s.value[4 + k]), c[k]);
+                            break;
+                        }
+                        case Op::AlphaPremultiply: {
+                            F alpha = c[3] / F(255.0f);
+                            for (int k = 0; k < 3; k++) c[k] = simd::Floor(c[k] * alpha);
+                            break;
+                        }
+                    }
+                }
+            }
+
+        public:
+            // Pixels per pool task.
+            static constexpr size_t parallelGrain = 16384;
+
+            ColorPipeline() = default;
+
+            // Binds Apply() to a target, e.g. the image that made the pipeline (see Image::Pipeline).
+            explicit ColorPipeline(std::function<void(const ColorPipeline&)> target) : target(std::move(target)) {}
+
+            size_t Size() const { return steps.size(); }
+            ColorPipeline& Clear() { steps.clear(); return (*this); }
+
+            // ImageColorTint; scales alpha too.
+            ColorPipeline& Tint(Colors color) {
+                return Add(Op::Tint, { color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f });
+            }
+
+            // ImageColorContrast, contrast in [-100, 100].
+            ColorPipeline& Contrast(float contrast) {
+                contrast = contrast < -100.0f ? -100.0f : (contrast > 100.0f ? 100.0f : contrast);
+                contrast = (100.0f + contrast) / 100.0f;
+                return Add(Op::Contrast, { contrast * contrast });
+            }
+
+            // ImageColorBrightness, brightness in [-255, 255].
+            ColorPipeline& Brightness(int brightness) {
+                return Add(Op::Brightness, { float(brightness < -255 ? -255 : (brightness > 255 ? 255 : brightness)) });
+            }
+
+            ColorPipeline& Invert() { return Add(Op::Invert); }
+            ColorPipeline& Grayscale() { return Add(Op::Grayscale); }
+
+            // ImageColorReplace: pixels equal to color (all four channels) become replace.
+            ColorPipeline& Replace(Colors color, Colors replace) {
+                return Add(Op::Replace, { float(color.r), float(color.g), float(color.b), float(color.a), float(replace.r), float(replace.g), float(replace.b), float(replace.a) });
+            }
+
+            ColorPipeline& AlphaPremultiply() { return Add(Op::AlphaPremultiply); }
+
+            // Runs every step on count pixels in place, in one pass split across the pool if given.
+            void Apply(Colors* pixels, size_t count, ThreadPool* pool = nullptr) const {
+                if (pixels == nullptr || steps.empty()) return;
+                auto body = [&](size_t begin, size_t end) {
+                    simd::Batch(end - begin, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        uint8_t* p = reinterpret_cast<uint8_t*>(pixels + begin + i);
+                        F c[4];
+                        simd::LoadRgba8(p, c[0], c[1], c[2], c[3]);
+                        Run(c);
+                        simd::StoreRgba8(c[0], c[1], c[2], c[3], p);
+                    });
+                };
+                if (pool && count >= 2 * parallelGrain) pool->ParallelFor(count, parallelGrain, body);
+                else body(0, count);
+            }
+
+            // RGBA8 views only; rows are split across the pool in parallelGrain-sized ranges.
+            void Apply(const ImageView& view, ThreadPool* pool = nullptr) const {
+                if (view.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 || view.Empty()) return;
+                if (view.Contiguous()) return Apply(view.Row<Colors>(0), size_t(view.width) * size_t(view.height), pool);
+                view.ForRows(pool, parallelGrain, [&](size_t begin, size_t end) {
+                    for (size_t y = begin; y < end; y++) Apply(view.Row<Colors>(int(y)), size_t(view.width));
+                });
+            }
+
+            // Applies to the bound target; does nothing for an unbound pipeline.
+            void Apply() const {
+                if (target) target(*this);
+            }
+        };
+    }
+}
+#endif
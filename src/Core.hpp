@@ -237,6 +237,8 @@
 #include "./RaylibExtern.hpp"
 #include "./Colors.hpp"
 #include "./Vector.hpp"
+#include "./VectorArray.hpp"
+#include "./Simd.hpp"
 #include "./Invokable.hpp"
 #include <string>
 
@@ -601,6 +603,53 @@ namespace raylib {
         };
 
         class Camera2D {
+        private:
+            static_assert(sizeof(Vector2D) == 2 * sizeof(float), "Vector2D must be two packed floats.");
+
+            // Camera matrix & inverse, valid for the offset/target/rotation/zoom they were built from.
+            Vector2D cachedOffset, cachedTarget;
+            float cachedRotation = 0.0f, cachedZoom = 0.0f;
+            bool cacheValid = false;
+            Matrix cachedMatrix, cachedInverse;
+
+            // Same matrix as GetCameraMatrix2D, rebuilt only when the camera moved since the last call.
+            void UpdateMatrices() {
+                if (cacheValid && offset == cachedOffset && target == cachedTarget && rotation == cachedRotation && zoom == cachedZoom) return;
+
+                Matrix origin = Matrix::Translate(-target.x, -target.y, 0.0f);
+                Matrix rotate = Matrix::Rotate(Vector3D(0.0f, 0.0f, 1.0f), rotation * DEG2RAD);
+                Matrix scale = Matrix::Scale(zoom, zoom, 1.0f);
+                Matrix translation = Matrix::Translate(offset.x, offset.y, 0.0f);
+
+                cachedMatrix = origin.Multiply(scale.Multiply(rotate)).Multiply(translation);
+                cachedInverse = Matrix(cachedMatrix).Invert();
+                cachedOffset = offset, cachedTarget = target, cachedRotation = rotation, cachedZoom = zoom;
+                cacheValid = true;
+            }
+
+            static void Transform(const Matrix& m, const Vector2D* positions, Vector2D* out, size_t count) {
+                const float* px = &positions[0].x, * py = &positions[0].y;
+                float* ox = &out[0].x, * oy = &out[0].y;
+                simd::Batch(count, [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F x = simd::LoadStrided<F>(px + 2 * i, 2), y = simd::LoadStrided<F>(py + 2 * i, 2);
+                    simd::StoreStrided(F(m.m0) * x + F(m.m4) * y + F(m.m12), ox + 2 * i, 2);
+                    simd::StoreStrided(F(m.m1) * x + F(m.m5) * y + F(m.m13), oy + 2 * i, 2);
+                });
+            }
+
+            static void Transform(const Matrix& m, const Vector2Array& positions, Vector2Array& out) {
+                out.Resize(positions.Size());
+                const float* px = positions.x.data(), * py = positions.y.data();
+                float* ox = out.x.data(), * oy = out.y.data();
+                simd::Batch(positions.Size(), [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F x = simd::Load<F>(px + i), y = simd::Load<F>(py + i);
+                    simd::Store(F(m.m0) * x + F(m.m4) * y + F(m.m12), ox + i);
+                    simd::Store(F(m.m1) * x + F(m.m5) * y + F(m.m13), oy + i);
+                });
+            }
+
         public:
             Vector2D offset, target;
             float rotation, zoom;
@@ -622,25 +671,120 @@ namespace raylib {
             operator ::Camera2D() { return { offset, target, rotation, zoom }; }
 
             Matrix GetMatrix() {
-                return ::GetCameraMatrix2D(*this);
+                UpdateMatrices();
+                return cachedMatrix;
+            }
+
+            Matrix GetInverseMatrix() {
+                UpdateMatrices();
+                return cachedInverse;
             }
 
             Vector2D GetWorldToScreen2D(Vector2D position) {
-                return ::GetWorldToScreen2D(position, *this);
+                UpdateMatrices();
+                const Matrix& m = cachedMatrix;
+                return Vector2D(m.m0 * position.x + m.m4 * position.y + m.m12, m.m1 * position.x + m.m5 * position.y + m.m13);
             }
 
             Vector2D GetScreenToWorld2D(Vector2D position) {
-                return ::GetScreenToWorld2D(position, *this);
+                UpdateMatrices();
+                const Matrix& m = cachedInverse;
+                return Vector2D(m.m0 * position.x + m.m4 * position.y + m.m12, m.m1 * position.x + m.m5 * position.y + m.m13);
+            }
+
+            /*
+                Batch versions: the matrices are built once per camera state and every position goes
+                through the SIMD kernel. out may alias positions. Vector2Array (structure-of-arrays)
+                input is the fastest form; Vector2D arrays are gathered into lanes.
+            */
+            void GetWorldToScreen2D(const Vector2D* positions, Vector2D* out, size_t count) {
+                UpdateMatrices();
+                Transform(cachedMatrix, positions, out, count);
+            }
+
+            void GetScreenToWorld2D(const Vector2D* positions, Vector2D* out, size_t count) {
+                UpdateMatrices();
+                Transform(cachedInverse, positions, out, count);
+            }
+
+            void GetWorldToScreen2D(const Vector2Array& positions, Vector2Array& out) {
+                UpdateMatrices();
+                Transform(cachedMatrix, positions, out);
+            }
+
+            void GetScreenToWorld2D(const Vector2Array& positions, Vector2Array& out) {
+                UpdateMatrices();
+                Transform(cachedInverse, positions, out);
             }
         };
 
         class Camera3D {
         private:
+            static_assert(sizeof(Vector3D) == 3 * sizeof(float), "Vector3D must be three packed floats.");
+
+            // View, projection & view * projection, valid for the camera state and viewport they were built from.
+            Vector3D cachedPosition, cachedTarget, cachedUp;
+            float cachedFovy = 0.0f;
+            int cachedProjection = 0, cachedWidth = 0, cachedHeight = 0;
+            bool cacheValid = false;
+            Matrix cachedView, cachedProjectionMatrix, cachedViewProjection;
+
             Camera3D& Clone(::Camera3D cam) {
                 this->position = cam.position, this->target = cam.target, this->upVector = cam.up;
                 this->fovy = cam.fovy;
                 this->projection = cam.projection;
+                return (*this);
             }
+
+            // Same matrices as GetWorldToScreenEx; each is rebuilt only when its inputs changed since the last call.
+            void UpdateMatrices(int width, int height) {
+                bool viewDirty = !cacheValid || !(position == cachedPosition && target == cachedTarget && upVector == cachedUp);
+                bool projectionDirty = !cacheValid || fovy != cachedFovy || projection != cachedProjection || width != cachedWidth || height != cachedHeight;
+                if (!viewDirty && !projectionDirty) return;
+
+                if (viewDirty) {
+                    cachedView = Matrix::LookAt(position, target, upVector);
+                    cachedPosition = position, cachedTarget = target, cachedUp = upVector;
+                }
+
+                if (projectionDirty) {
+                    cachedProjectionMatrix = Matrix::MatrixIdentity();
+                    if (projection == CAMERA_PERSPECTIVE) {
+                        cachedProjectionMatrix = Matrix::Perspective(fovy * DEG2RAD, (double)width / (double)height, 0.01, 1000.0);
+                    } else if (projection == CAMERA_ORTHOGRAPHIC) {
+                        float aspect = (float)width / (float)height;
+                        double top = fovy / 2.0, right = top * aspect;
+                        cachedProjectionMatrix = Matrix::OrthoProjection(-right, right, -top, top, 0.01, 1000.0);
+                    }
+                    cachedFovy = fovy, cachedProjection = projection, cachedWidth = width, cachedHeight = height;
+                }
+
+                cachedViewProjection = Matrix(cachedView).Multiply(cachedProjectionMatrix);
+                cacheValid = true;
+            }
+
+            /*
+                Projects lanes of world positions to screen coordinates like GetWorldToScreenEx. Also
+                returns the mask of points at or behind the camera plane (view-space z >= 0); their
+                screen coordinates are mirrored through the camera and should not be drawn.
+            */
+            template<typename F>
+            static auto ProjectLanes(const Matrix& m, const Matrix& view, float width, float height, F x, F y, F z, F& sx, F& sy) {
+                F cx = F(m.m0) * x + F(m.m4) * y + F(m.m8) * z + F(m.m12);
+                F cy = F(m.m1) * x + F(m.m5) * y + F(m.m9) * z + F(m.m13);
+                F cw = F(m.m3) * x + F(m.m7) * y + F(m.m11) * z + F(m.m15);
+                F iw = F(1.0f) / cw;
+                sx = (cx * iw + F(1.0f)) / F(2.0f) * F(width);
+                sy = (F(0.0f) - cy * iw + F(1.0f)) / F(2.0f) * F(height);
+                return (F(view.m2) * x + F(view.m6) * y + F(view.m10) * z + F(view.m14)) >= F(0.0f);
+            }
+
+            template<typename Mask>
+            static void StoreBehind(Mask mask, bool* behind, int lanes) {
+                int bits = simd::Bits(mask);
+                for (int l = 0; l < lanes; l++) behind[l] = (bits >> l) & 1;
+            }
+
         public:
             Vector3D position, target, upVector;
             float fovy;
@@ -694,20 +838,87 @@ namespace raylib {
                 ::SetCameraMoveControls(keyFront, keyBack, keyRight, keyLeft, keyUp, keyDown);
             }
 
+            // View matrix (GetCameraMatrix).
             Matrix GetMatrix() {
-                return ::GetCameraMatrix(*this);
+                UpdateMatrices(cachedWidth, cachedHeight);
+                return cachedView;
+            }
+
+            // Projection & view * projection for a viewport, as used by GetWorldToScreenEx.
+            Matrix GetProjectionMatrix(int width, int height) {
+                UpdateMatrices(width, height);
+                return cachedProjectionMatrix;
+            }
+
+            Matrix GetViewProjectionMatrix(int width, int height) {
+                UpdateMatrices(width, height);
+                return cachedViewProjection;
             }
 
+            Matrix GetProjectionMatrix() { return GetProjectionMatrix(::GetScreenWidth(), ::GetScreenHeight()); }
+            Matrix GetViewProjectionMatrix() { return GetViewProjectionMatrix(::GetScreenWidth(), ::GetScreenHeight()); }
+
             Ray GetMouseRay(Vector2D mousePosition) {
                 return ::GetMouseRay(mousePosition, *this);
             }
 
             Vector2D GetWorldToScreen(Vector3D position) {
-                return ::GetWorldToScreen(position, *this);
+                return GetWorldToScreenEx(position, ::GetScreenWidth(), ::GetScreenHeight());
             }
 
+            // Uses the cached view * projection, so results can differ from raylib's in the last bits.
             Vector2D GetWorldToScreenEx(Vector3D position, int width, int height) {
-                return ::GetWorldToScreenEx(position, *this, width, height);
+                UpdateMatrices(width, height);
+                float sx, sy;
+                ProjectLanes(cachedViewProjection, cachedView, (float)width, (float)height, position.x, position.y, position.z, sx, sy);
+                return Vector2D(sx, sy);
+            }
+
+            /*
+                Batch GetWorldToScreenEx: projects count points into out with SIMD, building the
+                matrices at most once. behind (optional, count entries) is set for points at or behind
+                the camera plane, whose screen positions are meaningless.
+            */
+            void ProjectPointsEx(const Vector3D* points, Vector2D* out, size_t count, int width, int height, bool* behind = nullptr) {
+                UpdateMatrices(width, height);
+                const Matrix& m = cachedViewProjection, & view = cachedView;
+                const float* p = &points[0].x;
+                float* o = &out[0].x, w = (float)width, h = (float)height;
+
+                simd::Batch(count, [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F x = simd::LoadStrided<F>(p + 3 * i, 3), y = simd::LoadStrided<F>(p + 3 * i + 1, 3), z = simd::LoadStrided<F>(p + 3 * i + 2, 3);
+                    F sx, sy;
+                    auto mask = ProjectLanes(m, view, w, h, x, y, z, sx, sy);
+                    simd::StoreStrided(sx, o + 2 * i, 2);
+                    simd::StoreStrided(sy, o + 2 * i + 1, 2);
+                    if (behind) StoreBehind(mask, behind + i, simd::Width<F>());
+                });
+            }
+
+            void ProjectPointsEx(const Vector3Array& points, Vector2Array& out, int width, int height, bool* behind = nullptr) {
+                UpdateMatrices(width, height);
+                const Matrix& m = cachedViewProjection, & view = cachedView;
+                out.Resize(points.Size());
+                const float* px = points.x.data(), * py = points.y.data(), * pz = points.z.data();
+                float* ox = out.x.data(), * oy = out.y.data(), w = (float)width, h = (float)height;
+
+                simd::Batch(points.Size(), [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F sx, sy;
+                    auto mask = ProjectLanes(m, view, w, h, simd::Load<F>(px + i), simd::Load<F>(py + i), simd::Load<F>(pz + i), sx, sy);
+                    simd::Store(sx, ox + i);
+                    simd::Store(sy, oy + i);
+                    if (behind) StoreBehind(mask, behind + i, simd::Width<F>());
+                });
+            }
+
+            void ProjectPoints(const Vector3D* points, Vector2D* out, size_t count, bool* behind = nullptr) {
+                ProjectPointsEx(points, out, count, ::GetScreenWidth(), ::GetScreenHeight(), behind);
+            }
+
+            void ProjectPoints(const Vector3Array& points, Vector2Array& out, bool* behind = nullptr) {
+                ProjectPointsEx(points, out, ::GetScreenWidth(), ::GetScreenHeight(), behind);
             }
         };
         typedef Camera3D Camera;
@@ -0,0 +1,179 @@
+/*
+    Frustum: six clip planes for view-frustum culling.
+
+    Planes come from the combined view * projection matrix (Gribb & Hartmann), normalized so
+    Distance(plane, p) is in world units and positive inside. A Frustum can be built from any
+    view/projection pair or straight from a Camera3D, using the same projection raylib's
+    BeginMode3D sets up.
+
+    The batch functions test Vector3Array (structure-of-arrays) spheres and boxes through
+    simd::Batch and write the indices of the visible objects to a compacted list:
+
+        Frustum frustum(camera, (float)GetScreenWidth() / GetScreenHeight());
+        size_t count = frustum.CullSpheres(centers, radii, visible.data());
+        for (size_t i = 0; i < count; i++) DrawModel(models[visible[i]], ...);
+
+    Tests are conservative: an object is kept unless it is fully outside one plane.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_FRUSTUM
+#define RAYLIB_PLUSPLUS_FRUSTUM
+#include "./RaylibExtern.hpp"
+#include "./Vector.hpp"
+#include "./VectorArray.hpp"
+#include "./Core.hpp"
+#include "./Simd.hpp"
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace raylib {
+    namespace cpp {
+        class Frustum {
+        private:
+            // Appends i + lane for every set lane bit.
+            static size_t Compact(int bits, size_t i, uint32_t* out, size_t count) {
+                for (uint32_t lane = 0; bits; lane++, bits >>= 1)
+                    if (bits & 1) out[count++] = static_cast<uint32_t>(i + lane);
+                return count;
+            }
+
+        public:
+            // Plane order in planes[], each stored as (a, b, c, d) with a*x + b*y + c*z + d >= 0 inside.
+            static constexpr int Left = 0, Right = 1, Bottom = 2, Top = 3, Near = 4, Far = 5;
+
+            Vector4D planes[6];
+
+            Frustum() {}
+            Frustum(Matrix view, Matrix projection) { Set(view, projection); }
+            Frustum(Matrix viewProjection) { Set(viewProjection); }
+
+            // Same projection as BeginMode3D (near 0.01, far 1000 by default; fovy in degrees).
+            Frustum(const Camera3D& camera, float aspect, double near = 0.01, double far = 1000.0) {
+                Matrix view = Matrix::LookAt(camera.position, camera.target, camera.upVector);
+                Matrix projection;
+
+                if (camera.projection == CAMERA_ORTHOGRAPHIC) {
+                    double top = camera.fovy / 2.0, right = top * aspect;
+                    projection = Matrix::OrthoProjection(-right, right, -top, top, near, far);
+                } else {
+                    projection = Matrix::Perspective(camera.fovy * DEG2RAD, aspect, near, far);
+                }
+
+                Set(view, projection);
+            }
+
+            Frustum& Set(Matrix view, Matrix projection) {
+                return Set(view.Multiply(projection));
+            }
+
+            // viewProjection = MatrixMultiply(view, projection), i.e. world -> clip space.
+            Frustum& Set(Matrix m) {
+                planes[Left] = Vector4D(m.m3 + m.m0, m.m7 + m.m4, m.m11 + m.m8, m.m15 + m.m12);
+                planes[Right] = Vector4D(m.m3 - m.m0, m.m7 - m.m4, m.m11 - m.m8, m.m15 - m.m12);
+                planes[Bottom] = Vector4D(m.m3 + m.m1, m.m7 + m.m5, m.m11 + m.m9, m.m15 + m.m13);
+                planes[Top] = Vector4D(m.m3 - m.m1, m.m7 - m.m5, m.m11 - m.m9, m.m15 - m.m13);
+                planes[Near] = Vector4D(m.m3 + m.m2, m.m7 + m.m6, m.m11 + m.m10, m.m15 + m.m14);
+                planes[Far] = Vector4D(m.m3 - m.m2, m.m7 - m.m6, m.m11 - m.m10, m.m15 - m.m14);
+
+                for (Vector4D& p : planes) {
+                    float length = sqrtf(p.x * p.x + p.y * p.y + p.z * p.z);
+                    if (length == 0.0f) length = 1.0f;
+                    float ilength = 1.0f / length;
+                    p = Vector4D(p.x * ilength, p.y * ilength, p.z * ilength, p.w * ilength);
+                }
+
+                return (*this);
+            }
+
+            static float Distance(Vector4D plane, Vector3D point) {
+                return plane.x * point.x + plane.y * point.y + plane.z * point.z + plane.w;
+            }
+
+            bool ContainsPoint(Vector3D point) const {
+                for (const Vector4D& p : planes)
+                    if (Distance(p, point) < 0.0f) return false;
+                return true;
+            }
+
+            bool IntersectsSphere(Vector3D center, float radius) const {
+                for (const Vector4D& p : planes)
+                    if (Distance(p, center) < -radius) return false;
+                return true;
+            }
+
+            // Tests the box corner furthest along each plane normal.
+            bool IntersectsBox(Vector3D min, Vector3D max) const {
+                for (const Vector4D& p : planes) {
+                    Vector3D corner(p.x >= 0.0f ? max.x : min.x, p.y >= 0.0f ? max.y : min.y, p.z >= 0.0f ? max.z : min.z);
+                    if (Distance(p, corner) < 0.0f) return false;
+                }
+                return true;
+            }
+
+            bool IntersectsBox(::BoundingBox box) const { return IntersectsBox(box.min, box.max); }
+
+            /*
+                Writes the indices of spheres that intersect the frustum to visible (room for
+                centers.Size() entries) and returns how many were written. Indices stay in order.
+            */
+            size_t CullSpheres(const Vector3Array& centers, const float* radii, uint32_t* visible) const {
+                const float* px = centers.x.data(), * py = centers.y.data(), * pz = centers.z.data();
+                size_t count = 0;
+
+                simd::Batch(centers.Size(), [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F x = simd::Load<F>(px + i), y = simd::Load<F>(py + i), z = simd::Load<F>(pz + i);
+                    F negRadius = F(0.0f) - simd::Load<F>(radii + i);
+
+                    auto inside = (F(planes[0].x) * x + F(planes[0].y) * y + F(planes[0].z) * z + F(planes[0].w)) >= negRadius;
+                    for (int p = 1; p < 6; p++)
+                        inside = inside & ((F(planes[p].x) * x + F(planes[p].y) * y + F(planes[p].z) * z + F(planes[p].w)) >= negRadius);
+
+                    count = Compact(simd::Bits(inside), i, visible, count);
+                });
+
+                return count;
+            }
+
+            size_t CullSpheres(const Vector3Array& centers, const float* radii, std::vector<uint32_t>& visible) const {
+                visible.resize(centers.Size());
+                visible.resize(CullSpheres(centers, radii, visible.data()));
+                return visible.size();
+            }
+
+            // Axis-aligned boxes given as matching min/max corner arrays. Same output contract as CullSpheres.
+            size_t CullBoxes(const Vector3Array& mins, const Vector3Array& maxs, uint32_t* visible) const {
+                // The furthest corner along each plane normal comes from min or max per axis,
+                // which is the same for every box, so pick the source arrays once per plane.
+                const float* corners[6][3];
+                for (int p = 0; p < 6; p++) {
+                    corners[p][0] = (planes[p].x >= 0.0f ? maxs.x : mins.x).data();
+                    corners[p][1] = (planes[p].y >= 0.0f ? maxs.y : mins.y).data();
+                    corners[p][2] = (planes[p].z >= 0.0f ? maxs.z : mins.z).data();
+                }
+
+                size_t count = 0;
+                simd::Batch(mins.Size(), [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    auto inside = F(0.0f) == F(0.0f);
+                    for (int p = 0; p < 6; p++) {
+                        F x = simd::Load<F>(corners[p][0] + i), y = simd::Load<F>(corners[p][1] + i), z = simd::Load<F>(corners[p][2] + i);
+                        inside = inside & ((F(planes[p].x) * x + F(planes[p].y) * y + F(planes[p].z) * z + F(planes[p].w)) >= F(0.0f));
+                    }
+
+                    count = Compact(simd::Bits(inside), i, visible, count);
+                });
+
+                return count;
+            }
+
+            size_t CullBoxes(const Vector3Array& mins, const Vector3Array& maxs, std::vector<uint32_t>& visible) const {
+                visible.resize(mins.Size());
+                visible.resize(CullBoxes(mins, maxs, visible.data()));
+                return visible.size();
+            }
+        };
+    }
+}
+#endif
@@ -0,0 +1,101 @@
+/*
+    Non-owning, strided view of a rectangle of uncompressed pixels.
+
+    An ImageView is a pointer to the first pixel, a size, a format and the byte stride between rows.
+    Sub-rectangles share the parent's pixels and stride, so working on a region of a large canvas
+    copies and allocates nothing:
+
+        ImageView panel = canvas.View(Rectangle(64, 64, 512, 256));
+        panel.Fill(Colors::Black());
+        Blitter::Blit(icon.View(), iconRec, panel, Rectangle(8, 8, 32, 32));
+        ColorPipeline().Contrast(20.0f).Apply(panel, &pool);
+        Resampler::Resize(photo.View(), panel.Sub(Rectangle(256, 0, 256, 256)), ResizeFilter::Bicubic, &pool);
+
+    The RGBA8 operations (ColorPipeline, ColorLut3D, ColorPalette, Blitter) and Resampler take views
+    directly. A view is only valid while the image it points into keeps its buffer: Format, Resize,
+    Crop and the other reallocating Image calls invalidate it.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_IMAGE_VIEW
+#define RAYLIB_PLUSPLUS_IMAGE_VIEW
+#include "./RaylibExtern.hpp"
+#include "./Colors.hpp"
+#include "./PixelConvert.hpp"
+#include "./ThreadPool.hpp"
+#include <cstdint>
+#include <cstring>
+
+namespace raylib {
+    namespace cpp {
+        class ImageView {
+        public:
+            void* data = nullptr;
+            int width = 0, height = 0, format = 0;
+            // Bytes from the start of one row to the next.
+            size_t stride = 0;
+
+            ImageView() = default;
+
+            // stride 0 means tightly packed rows.
+            ImageView(void* data, int width, int height, int format, size_t stride = 0)
+                : data(data), width(width), height(height), format(format),
+                stride(stride ? stride : size_t(width) * PixelConvert::BytesPerPixel(format)) {}
+
+            int BytesPerPixel() const { return PixelConvert::BytesPerPixel(format); }
+            bool Empty() const { return data == nullptr || width <= 0 || height <= 0 || BytesPerPixel() == 0; }
+            bool Contiguous() const { return stride == size_t(width) * BytesPerPixel(); }
+
+            template<typename T = uint8_t>
+            T* Row(int y) const { return reinterpret_cast<T*>(static_cast<uint8_t*>(data) + size_t(y) * stride); }
+
+            // The part of rec inside this view, as ImageCrop clips it; empty if they do not overlap.
+            ImageView Sub(::Rectangle rec) const {
+                int x = static_cast<int>(rec.x), y = static_cast<int>(rec.y);
+                int w = static_cast<int>(rec.width), h = static_cast<int>(rec.height);
+                if (x < 0) w += x, x = 0;
+                if (y < 0) h += y, y = 0;
+                if (x + w > width) w = width - x;
+                if (y + h > height) h = height - y;
+                if (Empty() || w <= 0 || h <= 0) return ImageView(nullptr, 0, 0, format, stride);
+                return ImageView(Row(y) + size_t(x) * BytesPerPixel(), w, h, format, stride);
+            }
+
+            // Calls body(beginRow, endRow) over ranges of about grainPixels pixels, split across the pool if given.
+            template<typename Body>
+            void ForRows(ThreadPool* pool, size_t grainPixels, Body&& body) const {
+                if (Empty()) return;
+                size_t rows = (grainPixels + size_t(width) - 1) / size_t(width);
+                rows = rows ? rows : 1;
+                if (pool && size_t(height) >= 2 * rows) pool->ParallelFor(size_t(height), rows, body);
+                else body(size_t(0), size_t(height));
+            }
+
+            // Sets every pixel to color, converted to the view's format as ImageFormat would.
+            ImageView& Fill(Colors color) {
+                if (Empty()) return (*this);
+                int size = BytesPerPixel();
+                uint8_t pixel[16];
+                PixelConvert::Convert(&color, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, pixel, format, 1, 1);
+
+                uint8_t* first = Row(0);
+                for (int x = 0; x < width; x++) std::memcpy(first + size_t(x) * size, pixel, size);
+                for (int y = 1; y < height; y++) std::memcpy(Row(y), first, size_t(width) * size);
+                return (*this);
+            }
+
+            // Copies src (same format) into the top-left of this view, clipped to both. Views may overlap.
+            ImageView& Copy(const ImageView& src) {
+                if (Empty() || src.Empty() || src.format != format) return (*this);
+                int w = src.width < width ? src.width : width, h = src.height < height ? src.height : height;
+                size_t bytes = size_t(w) * BytesPerPixel();
+                if (src.data < data) {
+                    for (int y = h - 1; y >= 0; y--) std::memmove(Row(y), src.Row(y), bytes);
+                } else {
+                    for (int y = 0; y < h; y++) std::memmove(Row(y), src.Row(y), bytes);
+                }
+                return (*this);
+            }
+        };
+    }
+}
+#endif
@@ -0,0 +1,89 @@
+/*
+    Math policies for the sqrt/trig inside Vector.hpp (and the batch kernels that take one).
+
+    Functions that use sqrt or trig take the policy as a template parameter defaulting to
+    ExactMath, so existing calls are unchanged and still match raymath bit for bit:
+
+        v.Normalize();                  // ExactMath: sqrtf, 1 / length
+        v.Normalize<FastMath>();        // FastMath: rsqrt estimate + one Newton step
+        q.FromEuler<FastMath>(pitch, yaw, roll);
+
+    FastMath error bounds (measured over the stated ranges, float precision):
+        InvSqrt, Sqrt       relative error < 3e-7 with SSE2/AVX2 (libm accuracy when SIMD is disabled)
+        Sin, Cos            absolute error < 1e-6 for |x| <= 1000, degree 7 polynomial after
+                            reduction to [-pi/2, pi/2]; the error grows slowly with |x| beyond that
+        Atan2               absolute error < 2e-6, degree 11 polynomial on [0, 1] plus octant
+                            fix-up; atan2(-0, -x) returns +pi instead of -pi
+
+    Every FastMath function is written once for float and simd::Float lanes, so batch kernels
+    can call it inside simd::Batch. ExactMath trig is scalar only.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_MATH_POLICY
+#define RAYLIB_PLUSPLUS_MATH_POLICY
+#include "./Simd.hpp"
+#include <cmath>
+
+namespace raylib {
+    namespace cpp {
+        struct ExactMath {
+            template<typename F> static F Sqrt(F x) noexcept { return simd::Sqrt(x); }
+            template<typename F> static F InvSqrt(F x) noexcept { return F(1.0f) / simd::Sqrt(x); }
+
+            static float Sin(float x) noexcept { return sinf(x); }
+            static float Cos(float x) noexcept { return cosf(x); }
+            static void SinCos(float x, float& s, float& c) noexcept { s = sinf(x), c = cosf(x); }
+            static float Atan2(float y, float x) noexcept { return atan2f(y, x); }
+        };
+
+        struct FastMath {
+            template<typename F> static F InvSqrt(F x) noexcept {
+                F r = simd::RSqrt(x);
+                return r * (F(1.5f) - F(0.5f) * x * r * r);
+            }
+
+            // 0 for x == 0 (x * InvSqrt(x) would be 0 * inf).
+            template<typename F> static F Sqrt(F x) noexcept {
+                return simd::Select(x > F(0.0f), x * InvSqrt(x), F(0.0f));
+            }
+
+            template<typename F> static void SinCos(F x, F& s, F& c) noexcept {
+                // x - k * 2pi with 2pi split in three parts (k * 6.28125 is exact), leaving x in [-pi, pi].
+                // Adding and removing 1.5 * 2^23 rounds to the nearest integer without a floorf call.
+                F k = (x * F(0.159154943f) + F(12582912.0f)) - F(12582912.0f);
+                x = ((x - k * F(6.28125f)) - k * F(0.00193530717f)) - k * F(1.02531317e-11f);
+
+                // sin(x) = sin(+-pi - x) folds onto [-pi/2, pi/2] with min/max instead of compares, so the
+                // scalar path stays branchless; cos(x) = sin(pi/2 - |x|) is already there.
+                F sx = simd::Max(simd::Min(x, F(3.14159274f) - x), F(-3.14159274f) - x);
+                F cx = F(1.57079637f) - simd::Abs(x);
+
+                s = SinPolynomial(sx), c = SinPolynomial(cx);
+            }
+
+            template<typename F> static F Sin(F x) noexcept { F s, c; SinCos(x, s, c); return s; }
+            template<typename F> static F Cos(F x) noexcept { F s, c; SinCos(x, s, c); return c; }
+
+            template<typename F> static F Atan2(F y, F x) noexcept {
+                F ax = simd::Abs(x), ay = simd::Abs(y);
+                F hi = simd::Max(ax, ay), lo = simd::Min(ax, ay);
+                F t = simd::Select(hi > F(0.0f), lo / hi, F(0.0f));
+
+                F t2 = t * t;
+                F a = t * (F(0.999977222f) + t2 * (F(-0.332622851f) + t2 * (F(0.193540433f) + t2 * (F(-0.116426509f) + t2 * (F(0.0526473079f) + t2 * F(-0.0117191012f))))));
+
+                a = simd::Select(ay > ax, F(1.57079637f) - a, a);
+                a = simd::Select(x < F(0.0f), F(3.14159274f) - a, a);
+                return simd::Select(y < F(0.0f), F(0.0f) - a, a);
+            }
+
+        private:
+            // Odd minimax polynomial for sin on [-pi/2, pi/2].
+            template<typename F> static F SinPolynomial(F x) noexcept {
+                F x2 = x * x;
+                return x * (F(0.999996617f) + x2 * (F(-0.166648286f) + x2 * (F(0.00830632682f) + x2 * F(-0.000183636885f))));
+            }
+        };
+    }
+}
+#endif
@@ -0,0 +1,105 @@
+/*
+    Builds a full mipmap chain in one pre-sized buffer, in the layout ImageMipmaps uses: level 0
+    followed by each smaller level, every level half the size of the one before (rounded down, at
+    least 1) down to 1x1.
+
+        size_t bytes = MipmapGenerator::Size(w, h, format, MipmapGenerator::Levels(w, h));
+        MipmapGenerator::Generate(chain, w, h, format, MipmapGenerator::Levels(w, h), ResizeFilter::Kaiser, true, &pool);
+
+        image.Mipmaps(ResizeFilter::Box, true, &pool);
+        texture.GenMipmaps(image, ResizeFilter::Kaiser, true, &pool);
+
+    Each level is filtered from the one above it, and large levels are split across the pool.
+    ResizeFilter::Box is the 2x2 average: RGBA8 levels with even sizes take a direct path (16-bit SSE2
+    sums, rounded), anything else goes through the Resampler (3 taps on an odd axis). Kaiser and the
+    other filters always use the Resampler; Kaiser is sharper with less aliasing and costs more.
+
+    With srgb, RGBA8 colour is averaged in linear light, so thin bright detail does not darken as it
+    shrinks; alpha is always averaged as stored. The sRGB Box path is scalar: twelve table decodes
+    and three quantizes per pixel are plain loads, which beat simd::Gather on SSE2 and AVX2. ImageMipmaps instead resizes a copy of the image
+    once per level and reallocates the chain as it grows.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_MIPMAP_GENERATOR
+#define RAYLIB_PLUSPLUS_MIPMAP_GENERATOR
+#include "./RaylibExtern.hpp"
+#include "./ColorBatch.hpp"
+#include "./ImageView.hpp"
+#include "./PixelConvert.hpp"
+#include "./Resampler.hpp"
+#include "./Simd.hpp"
+#include "./ThreadPool.hpp"
+#include <cstdint>
+
+namespace raylib {
+    namespace cpp {
+        class MipmapGenerator {
+        private:
+            // Halves an RGBA8 level with even width and height by averaging each 2x2 block.
+            static void Box(const uint8_t* src, int width, int height, uint8_t* dst, bool srgb, ThreadPool* pool) {
+                ImageView out(dst, width / 2, height / 2, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+                const ColorBatch::SrgbTables& tables = ColorBatch::Srgb();
+                size_t stride = size_t(width) * 4;
+                out.ForRows(pool, parallelGrain, [&](size_t begin, size_t end) {
+                    for (size_t y = begin; y < end; y++) {
+                        const uint8_t* row0 = src + 2 * y * stride, * row1 = row0 + stride;
+                        uint8_t* o = out.Row(int(y));
+                        if (!srgb) {
+                            simd::AverageRgba8(row0, row1, o, size_t(out.width));
+                            continue;
+                        }
+                        for (size_t x = 0; x < size_t(out.width); x++) {
+                            const uint8_t* a = row0 + x * 8, * b = row1 + x * 8;
+                            for (int c = 0; c < 3; c++)
+                                o[x * 4 + c] = tables.Quantize((tables.decode[a[c]] + tables.decode[a[4 + c]] + tables.decode[b[c]] + tables.decode[b[4 + c]]) * 0.25f);
+                            o[x * 4 + 3] = static_cast<uint8_t>((a[3] + a[7] + b[3] + b[7] + 2) >> 2);
+                        }
+                    }
+                });
+            }
+
+        public:
+            // Output pixels per pool task for the 2x2 box path.
+            static constexpr size_t parallelGrain = 65536;
+
+            static bool Supported(int format) { return Resampler::Supported(format); }
+
+            // Levels down to 1x1, counted as ImageMipmaps counts them (level 0 included).
+            static int Levels(int width, int height) {
+                int levels = 1;
+                while (width > 1 || height > 1) {
+                    width = width > 1 ? width / 2 : 1, height = height > 1 ? height / 2 : 1;
+                    levels++;
+                }
+                return levels;
+            }
+
+            // Bytes of a chain of `levels` levels of an uncompressed format.
+            static size_t Size(int width, int height, int format, int levels) {
+                size_t total = 0;
+                for (int level = 0; level < levels; level++) {
+                    total += size_t(width) * size_t(height) * PixelConvert::BytesPerPixel(format);
+                    width = width > 1 ? width / 2 : 1, height = height > 1 ? height / 2 : 1;
+                }
+                return total;
+            }
+
+            // Fills levels 1 to levels - 1 of chain from level 0 at its start. Unsupported formats are ignored.
+            static void Generate(void* chain, int width, int height, int format, int levels,
+                ResizeFilter filter = ResizeFilter::Box, bool srgb = false, ThreadPool* pool = nullptr) {
+                if (chain == nullptr || !Supported(format)) return;
+                uint8_t* level = static_cast<uint8_t*>(chain);
+                for (int i = 1; i < levels; i++) {
+                    int nextWidth = width > 1 ? width / 2 : 1, nextHeight = height > 1 ? height / 2 : 1;
+                    uint8_t* next = level + size_t(width) * size_t(height) * PixelConvert::BytesPerPixel(format);
+                    if (filter == ResizeFilter::Box && format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 && width % 2 == 0 && height % 2 == 0)
+                        Box(level, width, height, next, srgb, pool);
+                    else
+                        Resampler::Resize(ImageView(level, width, height, format), ImageView(next, nextWidth, nextHeight, format), filter, pool, srgb);
+                    level = next, width = nextWidth, height = nextHeight;
+                }
+            }
+        };
+    }
+}
+#endif
@@ -0,0 +1,308 @@
+/*
+    Packed storage for bulk vector data (point clouds, normals, colour ramps).
+
+        Snorm16Vector3/4    6/8 bytes   components in [-1, 1], steps of 1/32767
+        Unorm16Vector3/4    6/8 bytes   components in a [min, max] range, steps of (max - min)/65535
+        OctahedralNormal    4 bytes     unit vectors folded onto an octahedron, two snorm16
+        HalfVector4         8 bytes     IEEE half floats
+        Packed1010102       4 bytes     xyz in a [min, max] range with 10 bits each, w in [0, 1] with 2 bits
+                                        (x in the low bits, the GL_UNSIGNED_INT_2_10_10_10_REV layout)
+
+    PackedVector::Pack & Unpack convert whole arrays to and from Vector3D/Vector4D:
+
+        std::vector<Unorm16Vector3> packed(count);
+        PackedVector::Pack(points, packed.data(), count, bounds.min, bounds.max);
+        PackedVector::Unpack(packed.data(), points, count, bounds.min, bounds.max);
+
+    Quantization rounds to nearest and clamps out-of-range input. The 16-bit and half formats run
+    over the arrays as flat component streams through simd::Batch with 16-bit lane loads/stores.
+    Octahedral normals & 10:10:10:2 do their math in SIMD lanes and pack per element. Every
+    function takes an optional ThreadPool that splits arrays larger than parallelGrain.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_PACKED_VECTOR
+#define RAYLIB_PLUSPLUS_PACKED_VECTOR
+#include "./RaylibExtern.hpp"
+#include "./Vector.hpp"
+#include "./Simd.hpp"
+#include "./ThreadPool.hpp"
+#include <cfloat>
+#include <cstdint>
+
+namespace raylib {
+    namespace cpp {
+        struct Snorm16Vector3 { int16_t x, y, z; };
+        struct Snorm16Vector4 { int16_t x, y, z, w; };
+        struct Unorm16Vector3 { uint16_t x, y, z; };
+        struct Unorm16Vector4 { uint16_t x, y, z, w; };
+        struct OctahedralNormal { int16_t x, y; };
+        struct HalfVector4 { uint16_t x, y, z, w; };
+        struct Packed1010102 { uint32_t bits; };
+
+        class PackedVector {
+        private:
+            static_assert(sizeof(Vector3D) == 3 * sizeof(float), "Vector3D must be three packed floats.");
+            static_assert(sizeof(Vector4D) == 4 * sizeof(float), "Vector4D must be four packed floats.");
+
+            template<typename F>
+            static void Run(size_t count, ThreadPool* pool, F&& body) {
+                if (pool && count >= 2 * parallelGrain) pool->ParallelFor(count, parallelGrain, body);
+                else body(size_t(0), count);
+            }
+
+            /*
+                Runs kernel(offset, lane, scale, bias) over count elements of P floats each, where offset
+                indexes the flat float stream. scale & bias hold one value per component and are spread
+                across the lanes so each lane gets the value for the component it holds.
+            */
+            template<int P, typename Kernel>
+            static void Components(size_t count, const float (&scale)[P], const float (&bias)[P], Kernel&& kernel) {
+                constexpr int W = simd::Float::Width;
+                alignas(32) float s[P][W], b[P][W];
+                for (int k = 0; k < P; k++)
+                    for (int l = 0; l < W; l++)
+                        s[k][l] = scale[(k * W + l) % P], b[k][l] = bias[(k * W + l) % P];
+
+                simd::Float vs[P], vb[P];
+                for (int k = 0; k < P; k++)
+                    vs[k] = simd::Float::Load(s[k]), vb[k] = simd::Float::Load(b[k]);
+
+                // W elements are P full lanes, so the pattern lines up again after every group.
+                size_t i = 0;
+                for (; i + W <= count; i += W)
+                    for (int k = 0; k < P; k++)
+                        kernel(i * P + k * W, vs[k], vb[k]);
+                for (; i < count; i++)
+                    for (int k = 0; k < P; k++)
+                        kernel(i * P + k, scale[k], bias[k]);
+            }
+
+            // round(clamp(v * scale + bias, lo, hi)) into 16-bit integers.
+            template<int P, typename T>
+            static void Quantize(const float* in, T* out, size_t count, const float (&scale)[P], const float (&bias)[P], float lo, float hi) {
+                Components<P>(count, scale, bias, [&](size_t j, auto s, auto b) {
+                    using F = decltype(s);
+                    F q = simd::Min(simd::Max(simd::Load<F>(in + j) * s + b, F(lo)), F(hi));
+                    simd::Store(simd::Floor(q + F(0.5f)), out + j);
+                });
+            }
+
+            // max(q * scale + bias, lo).
+            template<int P, typename T>
+            static void Dequantize(const T* in, float* out, size_t count, const float (&scale)[P], const float (&bias)[P], float lo) {
+                Components<P>(count, scale, bias, [&](size_t j, auto s, auto b) {
+                    using F = decltype(s);
+                    simd::Store(simd::Max(simd::Load<F>(in + j) * s + b, F(lo)), out + j);
+                });
+            }
+
+            // Per-component scale & bias mapping [min, max] to [0, steps]; a zero-width range maps to 0.
+            template<int P>
+            static void RangeToSteps(const float* min, const float* max, float steps, float (&scale)[P], float (&bias)[P]) {
+                for (int k = 0; k < P; k++) {
+                    float extent = max[k] - min[k];
+                    scale[k] = extent != 0.0f ? steps / extent : 0.0f;
+                    bias[k] = -min[k] * scale[k];
+                }
+            }
+
+            template<int P>
+            static void StepsToRange(const float* min, const float* max, float steps, float (&scale)[P], float (&bias)[P]) {
+                for (int k = 0; k < P; k++)
+                    scale[k] = (max[k] - min[k]) / steps, bias[k] = min[k];
+            }
+
+        public:
+            // Elements per thread chunk in the batch functions.
+            static constexpr size_t parallelGrain = 16384;
+
+            /* snorm16: components clamped to [-1, 1]. */
+
+            static void Pack(const Vector3D* in, Snorm16Vector3* out, size_t count, ThreadPool* pool = nullptr) {
+                const float scale[3] = { 32767.0f, 32767.0f, 32767.0f }, bias[3] = { 0.0f, 0.0f, 0.0f };
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    Quantize<3>(&in[begin].x, &out[begin].x, end - begin, scale, bias, -32767.0f, 32767.0f);
+                });
+            }
+
+            static void Unpack(const Snorm16Vector3* in, Vector3D* out, size_t count, ThreadPool* pool = nullptr) {
+                const float scale[3] = { 1.0f / 32767.0f, 1.0f / 32767.0f, 1.0f / 32767.0f }, bias[3] = { 0.0f, 0.0f, 0.0f };
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    Dequantize<3>(&in[begin].x, &out[begin].x, end - begin, scale, bias, -1.0f);
+                });
+            }
+
+            static void Pack(const Vector4D* in, Snorm16Vector4* out, size_t count, ThreadPool* pool = nullptr) {
+                const float scale[4] = { 32767.0f, 32767.0f, 32767.0f, 32767.0f }, bias[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    Quantize<4>(&in[begin].x, &out[begin].x, end - begin, scale, bias, -32767.0f, 32767.0f);
+                });
+            }
+
+            static void Unpack(const Snorm16Vector4* in, Vector4D* out, size_t count, ThreadPool* pool = nullptr) {
+                const float scale[4] = { 1.0f / 32767.0f, 1.0f / 32767.0f, 1.0f / 32767.0f, 1.0f / 32767.0f }, bias[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    Dequantize<4>(&in[begin].x, &out[begin].x, end - begin, scale, bias, -1.0f);
+                });
+            }
+
+            /* unorm16: components clamped to [min, max], e.g. a point cloud's bounding box. */
+
+            static void Pack(const Vector3D* in, Unorm16Vector3* out, size_t count, Vector3D min, Vector3D max, ThreadPool* pool = nullptr) {
+                float scale[3], bias[3];
+                RangeToSteps<3>(&min.x, &max.x, 65535.0f, scale, bias);
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    Quantize<3>(&in[begin].x, &out[begin].x, end - begin, scale, bias, 0.0f, 65535.0f);
+                });
+            }
+
+            static void Unpack(const Unorm16Vector3* in, Vector3D* out, size_t count, Vector3D min, Vector3D max, ThreadPool* pool = nullptr) {
+                float scale[3], bias[3];
+                StepsToRange<3>(&min.x, &max.x, 65535.0f, scale, bias);
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    Dequantize<3>(&in[begin].x, &out[begin].x, end - begin, scale, bias, -FLT_MAX);
+                });
+            }
+
+            static void Pack(const Vector4D* in, Unorm16Vector4* out, size_t count, Vector4D min = Vector4D(0.0f, 0.0f, 0.0f, 0.0f), Vector4D max = Vector4D(1.0f, 1.0f, 1.0f, 1.0f), ThreadPool* pool = nullptr) {
+                float scale[4], bias[4];
+                RangeToSteps<4>(&min.x, &max.x, 65535.0f, scale, bias);
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    Quantize<4>(&in[begin].x, &out[begin].x, end - begin, scale, bias, 0.0f, 65535.0f);
+                });
+            }
+
+            static void Unpack(const Unorm16Vector4* in, Vector4D* out, size_t count, Vector4D min = Vector4D(0.0f, 0.0f, 0.0f, 0.0f), Vector4D max = Vector4D(1.0f, 1.0f, 1.0f, 1.0f), ThreadPool* pool = nullptr) {
+                float scale[4], bias[4];
+                StepsToRange<4>(&min.x, &max.x, 65535.0f, scale, bias);
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    Dequantize<4>(&in[begin].x, &out[begin].x, end - begin, scale, bias, -FLT_MAX);
+                });
+            }
+
+            /* Half floats: magnitudes above 65504 become infinity. */
+
+            static void Pack(const Vector4D* in, HalfVector4* out, size_t count, ThreadPool* pool = nullptr) {
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    const float* src = &in[begin].x;
+                    uint16_t* dst = &out[begin].x;
+                    simd::Batch((end - begin) * 4, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        simd::StoreHalf(simd::Load<F>(src + i), dst + i);
+                    });
+                });
+            }
+
+            static void Unpack(const HalfVector4* in, Vector4D* out, size_t count, ThreadPool* pool = nullptr) {
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    const uint16_t* src = &in[begin].x;
+                    float* dst = &out[begin].x;
+                    simd::Batch((end - begin) * 4, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        simd::Store(simd::LoadHalf<F>(src + i), dst + i);
+                    });
+                });
+            }
+
+            /*
+                Octahedral normals: the unit vector is projected onto the octahedron |x| + |y| + |z| = 1
+                and the lower half folded over the upper one, leaving two coordinates in [-1, 1].
+                Input need not be normalized; output is. A zero vector packs to (0, 0) and unpacks to +z.
+            */
+            static void Pack(const Vector3D* in, OctahedralNormal* out, size_t count, ThreadPool* pool = nullptr) {
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    simd::Batch(end - begin, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        const float* p = &in[begin + i].x;
+                        F x = simd::LoadStrided<F>(p, 3), y = simd::LoadStrided<F>(p + 1, 3), z = simd::LoadStrided<F>(p + 2, 3);
+
+                        F sum = simd::Abs(x) + simd::Abs(y) + simd::Abs(z);
+                        F inverse = simd::Select(sum > F(0.0f), F(1.0f) / sum, F(0.0f));
+                        F px = x * inverse, py = y * inverse;
+
+                        auto lower = z < F(0.0f);
+                        F fx = (F(1.0f) - simd::Abs(py)) * simd::Select(px >= F(0.0f), F(1.0f), F(-1.0f));
+                        F fy = (F(1.0f) - simd::Abs(px)) * simd::Select(py >= F(0.0f), F(1.0f), F(-1.0f));
+                        px = simd::Select(lower, fx, px), py = simd::Select(lower, fy, py);
+
+                        alignas(16) int16_t qx[simd::Float::Width], qy[simd::Float::Width];
+                        simd::Store(simd::Floor(simd::Min(simd::Max(px, F(-1.0f)), F(1.0f)) * F(32767.0f) + F(0.5f)), qx);
+                        simd::Store(simd::Floor(simd::Min(simd::Max(py, F(-1.0f)), F(1.0f)) * F(32767.0f) + F(0.5f)), qy);
+                        for (int l = 0; l < simd::Width<F>(); l++)
+                            out[begin + i + l] = { qx[l], qy[l] };
+                    });
+                });
+            }
+
+            static void Unpack(const OctahedralNormal* in, Vector3D* out, size_t count, ThreadPool* pool = nullptr) {
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    simd::Batch(end - begin, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        alignas(16) int16_t qx[simd::Float::Width], qy[simd::Float::Width];
+                        for (int l = 0; l < simd::Width<F>(); l++)
+                            qx[l] = in[begin + i + l].x, qy[l] = in[begin + i + l].y;
+
+                        F px = simd::Max(simd::Load<F>(qx) * F(1.0f / 32767.0f), F(-1.0f));
+                        F py = simd::Max(simd::Load<F>(qy) * F(1.0f / 32767.0f), F(-1.0f));
+                        F z = F(1.0f) - simd::Abs(px) - simd::Abs(py);
+
+                        // Unfold the lower half: shift x & y back towards the axes by the overshoot.
+                        F t = simd::Max(-z, F(0.0f));
+                        px = px + simd::Select(px >= F(0.0f), -t, t);
+                        py = py + simd::Select(py >= F(0.0f), -t, t);
+
+                        F ilength = F(1.0f) / simd::Sqrt(px * px + py * py + z * z);
+                        float* p = &out[begin + i].x;
+                        simd::StoreStrided(px * ilength, p, 3);
+                        simd::StoreStrided(py * ilength, p + 1, 3);
+                        simd::StoreStrided(z * ilength, p + 2, 3);
+                    });
+                });
+            }
+
+            /* 10:10:10:2: xyz clamped to [min, max], w clamped to [0, 1]. */
+
+            static void Pack(const Vector4D* in, Packed1010102* out, size_t count, Vector3D min = Vector3D(0.0f, 0.0f, 0.0f), Vector3D max = Vector3D(1.0f, 1.0f, 1.0f), ThreadPool* pool = nullptr) {
+                float scale[3], bias[3];
+                RangeToSteps<3>(&min.x, &max.x, 1023.0f, scale, bias);
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    simd::Batch(end - begin, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        const float* p = &in[begin + i].x;
+                        alignas(16) uint16_t q[4][simd::Float::Width];
+                        for (int k = 0; k < 3; k++) {
+                            F v = simd::LoadStrided<F>(p + k, 4) * F(scale[k]) + F(bias[k]);
+                            simd::Store(simd::Floor(simd::Min(simd::Max(v, F(0.0f)), F(1023.0f)) + F(0.5f)), q[k]);
+                        }
+                        F w = simd::LoadStrided<F>(p + 3, 4) * F(3.0f);
+                        simd::Store(simd::Floor(simd::Min(simd::Max(w, F(0.0f)), F(3.0f)) + F(0.5f)), q[3]);
+
+                        for (int l = 0; l < simd::Width<F>(); l++)
+                            out[begin + i + l].bits = uint32_t(q[0][l]) | uint32_t(q[1][l]) << 10 | uint32_t(q[2][l]) << 20 | uint32_t(q[3][l]) << 30;
+                    });
+                });
+            }
+
+            static void Unpack(const Packed1010102* in, Vector4D* out, size_t count, Vector3D min = Vector3D(0.0f, 0.0f, 0.0f), Vector3D max = Vector3D(1.0f, 1.0f, 1.0f), ThreadPool* pool = nullptr) {
+                float scale[3], bias[3];
+                StepsToRange<3>(&min.x, &max.x, 1023.0f, scale, bias);
+                Run(count, pool, [&](size_t begin, size_t end) {
+                    simd::Batch(end - begin, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        alignas(16) uint16_t q[4][simd::Float::Width];
+                        for (int l = 0; l < simd::Width<F>(); l++) {
+                            uint32_t bits = in[begin + i + l].bits;
+                            q[0][l] = bits & 0x3FFu, q[1][l] = (bits >> 10) & 0x3FFu, q[2][l] = (bits >> 20) & 0x3FFu, q[3][l] = bits >> 30;
+                        }
+
+                        float* p = &out[begin + i].x;
+                        for (int k = 0; k < 3; k++)
+                            simd::StoreStrided(simd::Load<F>(q[k]) * F(scale[k]) + F(bias[k]), p + k, 4);
+                        simd::StoreStrided(simd::Load<F>(q[3]) * F(1.0f / 3.0f), p + 3, 4);
+                    });
+                });
+            }
+        };
+    }
+}
+#endif
@@ -0,0 +1,318 @@
+/*
+    Direct pixel-format conversion for uncompressed images, used by Image::Format.
+
+    raylib's ImageFormat decodes the whole image into a Vector4 array (LoadImageDataNormalized),
+    then allocates the new buffer and encodes each pixel through a per-pixel switch. PixelConvert
+    does the same arithmetic in blocks of 256 pixels: a block is decoded into four planar float
+    channels that stay in L1, then encoded straight into the destination, both in simd::Batch
+    lanes. There is no intermediate image, so:
+
+        PixelConvert::Convert(src, srcFormat, dst, dstFormat, width, height, pool);
+
+    converts rows in parallel when a ThreadPool is given, and dst may be src itself when the
+    destination pixel is not larger than the source one (R8G8B8A8 -> R5G6B5, R32G32B32A32 -> R8G8B8A8).
+    In-place conversions to a smaller pixel run serially; blocks are read before they are written
+    and the write cursor never passes the read cursor.
+
+    Results are bit-exact with raylib 4.2's ImageFormat: 8-bit channels use the same x / 255.0f and
+    truncating x * 255.0f, 4/5/6-bit channels the same multiply by (1.0f / 31) and round-half-away,
+    grayscale the same 0.299/0.587/0.114 sum in the same order. Out-of-range float input (R32 formats)
+    clamps to each channel's range instead of wrapping. Compiling with FMA contraction enabled
+    (-mfma with GCC's default -ffp-contract=fast) can fuse the grayscale sum and change its last bit.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_PIXEL_CONVERT
+#define RAYLIB_PLUSPLUS_PIXEL_CONVERT
+#include "./RaylibExtern.hpp"
+#include "./Simd.hpp"
+#include "./ThreadPool.hpp"
+#include <cstdint>
+
+namespace raylib {
+    namespace cpp {
+        class PixelConvert {
+        private:
+            static constexpr int blockSize = 256;
+
+            struct Block {
+                alignas(32) float r[blockSize];
+                alignas(32) float g[blockSize];
+                alignas(32) float b[blockSize];
+                alignas(32) float a[blockSize];
+            };
+
+            // 8-bit channel 'channel' of n pixels 'stride' bytes apart, as value / 255.0f.
+            static void LoadBytes(const uint8_t* src, int stride, int channel, int n, float* out) {
+                alignas(32) uint16_t q[blockSize];
+                for (int i = 0; i < n; i++) q[i] = src[i * stride + channel];
+                simd::Batch(n, [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    simd::Store(simd::Load<F>(q + i) / F(255.0f), out + i);
+                });
+            }
+
+            // Truncates already scaled values (clamped to [0, 255]) into an 8-bit channel.
+            static void StoreBytes(const float* in, int n, uint8_t* dst, int stride, int channel) {
+                alignas(32) uint16_t q[blockSize];
+                simd::Batch(n, [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    simd::Store(simd::Min(simd::Max(simd::Load<F>(in + i), F(0.0f)), F(255.0f)), q + i);
+                });
+                for (int i = 0; i < n; i++) dst[i * stride + channel] = static_cast<uint8_t>(q[i]);
+            }
+
+            static void Fill(float* out, int n, float value) {
+                for (int i = 0; i < n; i++) out[i] = value;
+            }
+
+            // C's round(): half away from zero. Floor(v + 0.5f) would round v + 0.5f itself first.
+            template<typename F>
+            static F Round(F v, float max) {
+                F q = simd::Floor(v);
+                q = q + simd::Select(v - q >= F(0.5f), F(1.0f), F(0.0f));
+                return simd::Min(simd::Max(q, F(0.0f)), F(max));
+            }
+
+            template<typename F>
+            static F Gray(F r, F g, F b) { return r * F(0.299f) + g * F(0.587f) + b * F(0.114f); }
+
+            // LoadImageDataNormalized for n pixels starting at src.
+            static void Decode(int format, const uint8_t* src, int n, Block& block) {
+                const uint16_t* src16 = reinterpret_cast<const uint16_t*>(src);
+                const float* src32 = reinterpret_cast<const float*>(src);
+
+                switch (format) {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                    LoadBytes(src, 1, 0, n, block.r);
+                    for (int i = 0; i < n; i++) block.g[i] = block.b[i] = block.r[i];
+                    Fill(block.a, n, 1.0f);
+                    break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                    LoadBytes(src, 2, 0, n, block.r);
+                    LoadBytes(src, 2, 1, n, block.a);
+                    for (int i = 0; i < n; i++) block.g[i] = block.b[i] = block.r[i];
+                    break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                    LoadBytes(src, 3, 0, n, block.r);
+                    LoadBytes(src, 3, 1, n, block.g);
+                    LoadBytes(src, 3, 2, n, block.b);
+                    Fill(block.a, n, 1.0f);
+                    break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                    simd::Batch(n, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        F r, g, b, a;
+                        simd::LoadRgba8(src + i * 4, r, g, b, a);
+                        simd::Store(r / F(255.0f), block.r + i), simd::Store(g / F(255.0f), block.g + i);
+                        simd::Store(b / F(255.0f), block.b + i), simd::Store(a / F(255.0f), block.a + i);
+                    });
+                    break;
+                // 16-bit pixels split with exact float arithmetic: every value is an integer below 2^16.
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                    simd::Batch(n, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        F p = simd::Load<F>(src16 + i);
+                        F r = simd::Floor(p * F(1.0f / 2048.0f)); p = p - r * F(2048.0f);
+                        F g = simd::Floor(p * F(1.0f / 32.0f)); p = p - g * F(32.0f);
+                        simd::Store(r * F(1.0f / 31), block.r + i), simd::Store(g * F(1.0f / 63), block.g + i);
+                        simd::Store(p * F(1.0f / 31), block.b + i), simd::Store(F(1.0f), block.a + i);
+                    });
+                    break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                    simd::Batch(n, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        F p = simd::Load<F>(src16 + i);
+                        F r = simd::Floor(p * F(1.0f / 2048.0f)); p = p - r * F(2048.0f);
+                        F g = simd::Floor(p * F(1.0f / 64.0f)); p = p - g * F(64.0f);
+                        F b = simd::Floor(p * F(1.0f / 2.0f)); p = p - b * F(2.0f);
+                        simd::Store(r * F(1.0f / 31), block.r + i), simd::Store(g * F(1.0f / 31), block.g + i);
+                        simd::Store(b * F(1.0f / 31), block.b + i), simd::Store(p, block.a + i);
+                    });
+                    break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                    simd::Batch(n, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        F p = simd::Load<F>(src16 + i);
+                        F r = simd::Floor(p * F(1.0f / 4096.0f)); p = p - r * F(4096.0f);
+                        F g = simd::Floor(p * F(1.0f / 256.0f)); p = p - g * F(256.0f);
+                        F b = simd::Floor(p * F(1.0f / 16.0f)); p = p - b * F(16.0f);
+                        simd::Store(r * F(1.0f / 15), block.r + i), simd::Store(g * F(1.0f / 15), block.g + i);
+                        simd::Store(b * F(1.0f / 15), block.b + i), simd::Store(p * F(1.0f / 15), block.a + i);
+                    });
+                    break;
+                case PIXELFORMAT_UNCOMPRESSED_R32:
+                    for (int i = 0; i < n; i++) block.r[i] = src32[i];
+                    Fill(block.g, n, 0.0f), Fill(block.b, n, 0.0f), Fill(block.a, n, 1.0f);
+                    break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                    for (int i = 0; i < n; i++)
+                        block.r[i] = src32[i * 3], block.g[i] = src32[i * 3 + 1], block.b[i] = src32[i * 3 + 2];
+                    Fill(block.a, n, 1.0f);
+                    break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                    for (int i = 0; i < n; i++)
+                        block.r[i] = src32[i * 4], block.g[i] = src32[i * 4 + 1], block.b[i] = src32[i * 4 + 2], block.a[i] = src32[i * 4 + 3];
+                    break;
+                }
+            }
+
+            // The ImageFormat encode for n pixels starting at dst. Overwrites the block.
+            static void Encode(int format, Block& block, int n, uint8_t* dst) {
+                uint16_t* dst16 = reinterpret_cast<uint16_t*>(dst);
+                float* dst32 = reinterpret_cast<float*>(dst);
+
+                switch (format) {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                    simd::Batch(n, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        F gray = Gray(simd::Load<F>(block.r + i), simd::Load<F>(block.g + i), simd::Load<F>(block.b + i));
+                        simd::Store(gray * F(255.0f), block.r + i);
+                        simd::Store(simd::Load<F>(block.a + i) * F(255.0f), block.a + i);
+                    });
+                    if (format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) {
+                        StoreBytes(block.r, n, dst, 1, 0);
+                    } else {
+                        StoreBytes(block.r, n, dst, 2, 0);
+                        StoreBytes(block.a, n, dst, 2, 1);
+                    }
+                    break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                    simd::Batch(n, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        simd::Store(simd::Load<F>(block.r + i) * F(255.0f), block.r + i);
+                        simd::Store(simd::Load<F>(block.g + i) * F(255.0f), block.g + i);
+                        simd::Store(simd::Load<F>(block.b + i) * F(255.0f), block.b + i);
+                    });
+                    StoreBytes(block.r, n, dst, 3, 0);
+                    StoreBytes(block.g, n, dst, 3, 1);
+                    StoreBytes(block.b, n, dst, 3, 2);
+                    break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                    simd::Batch(n, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        simd::StoreRgba8(simd::Load<F>(block.r + i) * F(255.0f), simd::Load<F>(block.g + i) * F(255.0f),
+                            simd::Load<F>(block.b + i) * F(255.0f), simd::Load<F>(block.a + i) * F(255.0f), dst + i * 4);
+                    });
+                    break;
+                // 16-bit pixels packed as exact float sums, then stored as uint16.
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                    simd::Batch(n, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        F r = Round(simd::Load<F>(block.r + i) * F(31.0f), 31.0f);
+                        F g = Round(simd::Load<F>(block.g + i) * F(63.0f), 63.0f);
+                        F b = Round(simd::Load<F>(block.b + i) * F(31.0f), 31.0f);
+                        simd::Store(r * F(2048.0f) + g * F(32.0f) + b, dst16 + i);
+                    });
+                    break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                    simd::Batch(n, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        F r = Round(simd::Load<F>(block.r + i) * F(31.0f), 31.0f);
+                        F g = Round(simd::Load<F>(block.g + i) * F(31.0f), 31.0f);
+                        F b = Round(simd::Load<F>(block.b + i) * F(31.0f), 31.0f);
+                        F a = simd::Select(simd::Load<F>(block.a + i) > F(50.0f / 255.0f), F(1.0f), F(0.0f));
+                        simd::Store(r * F(2048.0f) + g * F(64.0f) + b * F(2.0f) + a, dst16 + i);
+                    });
+                    break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                    simd::Batch(n, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        F r = Round(simd::Load<F>(block.r + i) * F(15.0f), 15.0f);
+                        F g = Round(simd::Load<F>(block.g + i) * F(15.0f), 15.0f);
+                        F b = Round(simd::Load<F>(block.b + i) * F(15.0f), 15.0f);
+                        F a = Round(simd::Load<F>(block.a + i) * F(15.0f), 15.0f);
+                        simd::Store(r * F(4096.0f) + g * F(256.0f) + b * F(16.0f) + a, dst16 + i);
+                    });
+                    break;
+                case PIXELFORMAT_UNCOMPRESSED_R32:
+                    simd::Batch(n, [&](size_t i, auto lane) {
+                        using F = decltype(lane);
+                        simd::Store(Gray(simd::Load<F>(block.r + i), simd::Load<F>(block.g + i), simd::Load<F>(block.b + i)), dst32 + i);
+                    });
+                    break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                    for (int i = 0; i < n; i++)
+                        dst32[i * 3] = block.r[i], dst32[i * 3 + 1] = block.g[i], dst32[i * 3 + 2] = block.b[i];
+                    break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                    for (int i = 0; i < n; i++)
+                        dst32[i * 4] = block.r[i], dst32[i * 4 + 1] = block.g[i], dst32[i * 4 + 2] = block.b[i], dst32[i * 4 + 3] = block.a[i];
+                    break;
+                }
+            }
+
+            static void ConvertRange(const uint8_t* src, int srcFormat, uint8_t* dst, int dstFormat, size_t begin, size_t end) {
+                int srcSize = BytesPerPixel(srcFormat), dstSize = BytesPerPixel(dstFormat);
+                Block block;
+                for (size_t i = begin; i < end; i += blockSize) {
+                    int n = static_cast<int>(end - i < size_t(blockSize) ? end - i : size_t(blockSize));
+                    Decode(srcFormat, src + i * srcSize, n, block);
+                    Encode(dstFormat, block, n, dst + i * dstSize);
+                }
+            }
+
+        public:
+            // Images with fewer pixels than twice this are never split across a pool.
+            static constexpr size_t parallelGrain = 16384;
+
+            // The uncompressed formats ImageFormat can convert between.
+            static bool Supported(int format) {
+                switch (format) {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                case PIXELFORMAT_UNCOMPRESSED_R32:
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                    return true;
+                default:
+                    return false;
+                }
+            }
+
+            // 0 for formats Supported() rejects.
+            static int BytesPerPixel(int format) {
+                switch (format) {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: return 1;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: return 2;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5: return 2;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8: return 3;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: return 2;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: return 2;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: return 4;
+                case PIXELFORMAT_UNCOMPRESSED_R32: return 4;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32: return 12;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: return 16;
+                default: return 0;
+                }
+            }
+
+            /*
+                Converts width * height pixels. Both formats must be Supported(). dst may equal src when
+                BytesPerPixel(dstFormat) <= BytesPerPixel(srcFormat); if it is strictly smaller the
+                conversion ignores the pool, since a row's output would overwrite rows still to be read.
+            */
+            static void Convert(const void* src, int srcFormat, void* dst, int dstFormat, int width, int height, ThreadPool* pool = nullptr) {
+                const uint8_t* in = static_cast<const uint8_t*>(src);
+                uint8_t* out = static_cast<uint8_t*>(dst);
+                size_t count = size_t(width) * size_t(height);
+                bool shrinkInPlace = src == dst && BytesPerPixel(dstFormat) < BytesPerPixel(srcFormat);
+
+                if (pool && !shrinkInPlace && count >= 2 * parallelGrain) {
+                    size_t rows = (parallelGrain + width - 1) / width;
+                    pool->ParallelFor(size_t(height), rows, [&](size_t begin, size_t end) {
+                        ConvertRange(in, srcFormat, out, dstFormat, begin * width, end * width);
+                    });
+                } else {
+                    ConvertRange(in, srcFormat, out, dstFormat, 0, count);
+                }
+            }
+        };
+    }
+}
+#endif
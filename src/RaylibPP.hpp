@@ -31,8 +31,31 @@
 #define RAYLIB_PLUSPLUS
 	#include "./RaylibExtern.hpp"
 	#include "./Colors.hpp"
+	#include "./MathPolicy.hpp"
 	#include "./Vector.hpp"
+	#include "./VectorArray.hpp"
+	#include "./VectorExpression.hpp"
+	#include "./PackedVector.hpp"
+	#include "./ColorBatch.hpp"
+	#include "./ColorLut.hpp"
+	#include "./ColorPalette.hpp"
+	#include "./ColorPipeline.hpp"
+	#include "./SimdMatrix.hpp"
+	#include "./ThreadPool.hpp"
+	#include "./TransformHierarchy.hpp"
+	#include "./Animation.hpp"
+	#include "./Frustum.hpp"
+	#include "./Bvh.hpp"
+	#include "./PixelConvert.hpp"
+	#include "./ImageView.hpp"
+	#include "./Blitter.hpp"
+	#include "./Resampler.hpp"
+	#include "./MipmapGenerator.hpp"
+	#include "./BlockEncoder.hpp"
 	#include "./Textures.hpp"
+	#include "./AsyncTextureLoader.hpp"
+	#include "./TextureAtlas.hpp"
+	#include "./SpatialHash.hpp"
 	#include "./Text.hpp"
 	
 	/// NON-RAYLIB ADDITIONS ///
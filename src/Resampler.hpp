@@ -0,0 +1,269 @@
+/*
+    Separable image resampling for RGBA8 and 32-bit float pixels, used by Image::Resize(w, h, filter).
+
+        Resampler::Resize(src.data, src.w, src.h, dst, 1024, 1024, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+            ResizeFilter::Lanczos3, &pool);
+
+    Filters: Bilinear (triangle), Bicubic (Catmull-Rom), Lanczos3, Box and Kaiser (sinc under a
+    Kaiser window, radius 3, alpha 4; the usual mipmap filter). Downscaling widens the filter by the
+    scale factor, so every source pixel contributes. Taps past the image edge are dropped and the
+    remaining weights renormalized. Per-axis weights are computed once per call and trimmed of zero
+    taps, so an axis that keeps its size copies through unchanged.
+
+    Output rows are processed in tiles of parallelRows, split across the pool if one is given. A tile
+    decodes and horizontally filters the source rows it needs into planar floats (one plane per
+    channel), then filters those vertically. The horizontal pass gathers source taps per output pixel
+    (simd::Gather), the vertical pass is contiguous multiply-adds. Both run in simd::Batch lanes.
+    Resize also takes ImageViews, to scale a region of one image into a region of another.
+
+    RGBA8 results are rounded to nearest and clamped, so Bicubic/Lanczos overshoot does not wrap.
+    Channels are filtered independently, like ImageResize; alpha is not premultiplied. The srgb
+    flag filters RGBA8 colour in linear light instead, so downscaled detail keeps its brightness.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_RESAMPLER
+#define RAYLIB_PLUSPLUS_RESAMPLER
+#include "./RaylibExtern.hpp"
+#include "./ColorBatch.hpp"
+#include "./ImageView.hpp"
+#include "./Simd.hpp"
+#include "./ThreadPool.hpp"
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace raylib {
+    namespace cpp {
+        enum class ResizeFilter { Bilinear, Bicubic, Lanczos3, Box, Kaiser };
+
+        class Resampler {
+        private:
+            static float Radius(ResizeFilter filter) {
+                switch (filter) {
+                    case ResizeFilter::Box: return 0.5f;
+                    case ResizeFilter::Bilinear: return 1.0f;
+                    case ResizeFilter::Bicubic: return 2.0f;
+                    default: return 3.0f;
+                }
+            }
+
+            // sin(pi x) / (pi x), with exact zeros at the integers (float sin(pi * n) is not), so unscaled axes stay a copy.
+            static float Sinc(float x) {
+                if (x < 1e-6f) return 1.0f;
+                if (std::fabs(x - std::round(x)) < 1e-5f) return 0.0f;
+                const float pi = 3.14159265358979f;
+                return std::sin(pi * x) / (pi * x);
+            }
+
+            // Modified Bessel function of the first kind, order 0, for the Kaiser window.
+            static double BesselI0(double x) {
+                double sum = 1.0, term = 1.0;
+                for (int k = 1; k < 32 && term > 1e-12 * sum; k++) {
+                    term *= (x / (2.0 * k)) * (x / (2.0 * k));
+                    sum += term;
+                }
+                return sum;
+            }
+
+            static float Kernel(ResizeFilter filter, float x) {
+                x = std::fabs(x);
+                switch (filter) {
+                    case ResizeFilter::Box: return x < 0.5f ? 1.0f : (x == 0.5f ? 0.5f : 0.0f);
+                    case ResizeFilter::Bilinear: return x < 1.0f ? 1.0f - x : 0.0f;
+                    case ResizeFilter::Bicubic:
+                        // Catmull-Rom (B = 0, C = 0.5).
+                        if (x < 1.0f) return (1.5f * x - 2.5f) * x * x + 1.0f;
+                        if (x < 2.0f) return ((-0.5f * x + 2.5f) * x - 4.0f) * x + 2.0f;
+                        return 0.0f;
+                    case ResizeFilter::Kaiser: {
+                        // Sinc under a Kaiser window of radius 3, alpha 4.
+                        if (x >= 3.0f) return 0.0f;
+                        double t = x / 3.0;
+                        return Sinc(x) * static_cast<float>(BesselI0(4.0 * std::sqrt(1.0 - t * t)) / BesselI0(4.0));
+                    }
+                    default:
+                        return x < 3.0f ? Sinc(x) * Sinc(x / 3.0f) : 0.0f;
+                }
+            }
+
+            // Source taps per output coordinate, padded with zero weights to the widest (tap k of output i at [k * size + i]).
+            struct Axis {
+                int size = 0, taps = 0;
+                std::vector<int> first, count;
+                std::vector<float> index, weight;
+
+                Axis(int srcSize, int dstSize, ResizeFilter filter) : size(dstSize), first(dstSize), count(dstSize) {
+                    float scale = float(srcSize) / float(dstSize);
+                    float stretch = scale > 1.0f ? scale : 1.0f, support = Radius(filter) * stretch;
+                    std::vector<std::vector<float>> weights(dstSize);
+
+                    for (int i = 0; i < dstSize; i++) {
+                        float center = (float(i) + 0.5f) * scale;
+                        int lo = static_cast<int>(std::floor(center - support)), hi = static_cast<int>(std::ceil(center + support));
+                        lo = lo < 0 ? 0 : lo, hi = hi > srcSize - 1 ? srcSize - 1 : hi;
+
+                        std::vector<float>& w = weights[i];
+                        float total = 0.0f;
+                        for (int j = lo; j <= hi; j++) {
+                            w.push_back(Kernel(filter, (float(j) + 0.5f - center) / stretch));
+                            total += w.back();
+                        }
+                        // Trim zero taps at both ends; a degenerate window falls back to the nearest pixel.
+                        size_t begin = 0, end = w.size();
+                        while (begin < end && w[begin] == 0.0f) begin++;
+                        while (end > begin && w[end - 1] == 0.0f) end--;
+                        if (begin == end || total == 0.0f) {
+                            int nearest = static_cast<int>(center);
+                            w.assign(1, 1.0f), total = 1.0f, lo = nearest < srcSize ? nearest : srcSize - 1, begin = 0, end = 1;
+                        }
+                        w = std::vector<float>(w.begin() + begin, w.begin() + end);
+                        for (float& v : w) v /= total;
+
+                        first[i] = lo + int(begin), count[i] = int(w.size());
+                        if (count[i] > taps) taps = count[i];
+                    }
+
+                    index.resize(size_t(taps) * dstSize), weight.resize(size_t(taps) * dstSize);
+                    for (int i = 0; i < dstSize; i++)
+                        for (int k = 0; k < taps; k++) {
+                            bool used = k < count[i];
+                            index[size_t(k) * dstSize + i] = float(first[i] + (used ? k : 0));
+                            weight[size_t(k) * dstSize + i] = used ? weights[i][k] : 0.0f;
+                        }
+                }
+            };
+
+            // One row of pixels to / from channel planes of `width` floats each. With srgb, RGBA8 colour channels are linear in [0, 1].
+            static void Decode(const void* row, int format, int width, float* planes, const ColorBatch::SrgbTables* srgb) {
+                size_t w = size_t(width);
+                if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+                    const uint8_t* p = static_cast<const uint8_t*>(row);
+                    simd::Batch(w, [&](size_t x, auto lane) {
+                        using F = decltype(lane);
+                        F r, g, b, a;
+                        simd::LoadRgba8(p + x * 4, r, g, b, a);
+                        if (srgb) r = simd::Gather(srgb->decode, r), g = simd::Gather(srgb->decode, g), b = simd::Gather(srgb->decode, b);
+                        simd::Store(r, planes + x), simd::Store(g, planes + w + x), simd::Store(b, planes + 2 * w + x), simd::Store(a, planes + 3 * w + x);
+                    });
+                    return;
+                }
+                const float* p = static_cast<const float*>(row);
+                int channels = Channels(format);
+                simd::Batch(w, [&](size_t x, auto lane) {
+                    using F = decltype(lane);
+                    for (int c = 0; c < channels; c++) simd::Store(simd::LoadStrided<F>(p + x * channels + c, channels), planes + c * w + x);
+                });
+            }
+
+            static void Encode(const float* planes, int format, int width, void* row, const ColorBatch::SrgbTables* srgb) {
+                size_t w = size_t(width);
+                if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 && srgb) {
+                    uint8_t* p = static_cast<uint8_t*>(row);
+                    for (size_t x = 0; x < w; x++) {
+                        float a = planes[3 * w + x] + 0.5f;
+                        p[x * 4 + 0] = srgb->Quantize(planes[x]), p[x * 4 + 1] = srgb->Quantize(planes[w + x]), p[x * 4 + 2] = srgb->Quantize(planes[2 * w + x]);
+                        p[x * 4 + 3] = static_cast<uint8_t>(a < 0.0f ? 0.0f : (a > 255.0f ? 255.0f : a));
+                    }
+                    return;
+                }
+                if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+                    uint8_t* p = static_cast<uint8_t*>(row);
+                    simd::Batch(w, [&](size_t x, auto lane) {
+                        using F = decltype(lane);
+                        F half(0.5f);
+                        simd::StoreRgba8(simd::Floor(simd::Load<F>(planes + x) + half), simd::Floor(simd::Load<F>(planes + w + x) + half),
+                            simd::Floor(simd::Load<F>(planes + 2 * w + x) + half), simd::Floor(simd::Load<F>(planes + 3 * w + x) + half), p + x * 4);
+                    });
+                    return;
+                }
+                float* p = static_cast<float*>(row);
+                int channels = Channels(format);
+                simd::Batch(w, [&](size_t x, auto lane) {
+                    using F = decltype(lane);
+                    for (int c = 0; c < channels; c++) simd::StoreStrided(simd::Load<F>(planes + c * w + x), p + x * channels + c, channels);
+                });
+            }
+
+        public:
+            // Output rows per tile (and per pool task).
+            static constexpr int parallelRows = 32;
+
+            // Channels per pixel for supported formats, 0 otherwise.
+            static int Channels(int format) {
+                switch (format) {
+                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: return 4;
+                    case PIXELFORMAT_UNCOMPRESSED_R32: return 1;
+                    case PIXELFORMAT_UNCOMPRESSED_R32G32B32: return 3;
+                    case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: return 4;
+                    default: return 0;
+                }
+            }
+
+            static bool Supported(int format) { return Channels(format) != 0; }
+
+            // Resizes src into dst (dstWidth * dstHeight pixels of the same format). Unsupported formats are ignored.
+            static void Resize(const void* src, int srcWidth, int srcHeight, void* dst, int dstWidth, int dstHeight, int format,
+                ResizeFilter filter = ResizeFilter::Bicubic, ThreadPool* pool = nullptr) {
+                Resize(ImageView(const_cast<void*>(src), srcWidth, srcHeight, format), ImageView(dst, dstWidth, dstHeight, format), filter, pool);
+            }
+
+            /*
+                Resizes the whole of src to fill dst; both views must have the same supported format.
+                srgb filters RGBA8 colour in linear light (decoded from sRGB, re-encoded rounded to nearest).
+            */
+            static void Resize(const ImageView& src, const ImageView& dst, ResizeFilter filter = ResizeFilter::Bicubic, ThreadPool* pool = nullptr, bool srgb = false) {
+                int format = src.format, channels = Channels(format);
+                if (src.Empty() || dst.Empty() || channels == 0 || dst.format != format) return;
+                const ColorBatch::SrgbTables* tables = srgb && format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 ? &ColorBatch::Srgb() : nullptr;
+                int srcWidth = src.width, srcHeight = src.height, dstWidth = dst.width, dstHeight = dst.height;
+                Axis columns(srcWidth, dstWidth, filter), rows(srcHeight, dstHeight, filter);
+                size_t rowPlanes = size_t(channels) * dstWidth;
+
+                auto tile = [&](size_t tileBegin, size_t tileEnd) {
+                    std::vector<float> decoded(size_t(channels) * srcWidth), filtered, result(rowPlanes);
+                    for (size_t y0 = tileBegin; y0 < tileEnd; y0 += parallelRows) {
+                        size_t y1 = y0 + parallelRows < tileEnd ? y0 + parallelRows : tileEnd;
+
+                        // Horizontal pass over the source rows this tile reads.
+                        int top = rows.first[y0], bottom = top;
+                        for (size_t y = y0; y < y1; y++)
+                            if (rows.first[y] + rows.count[y] > bottom) bottom = rows.first[y] + rows.count[y];
+                        filtered.resize(size_t(bottom - top) * rowPlanes);
+                        for (int sy = top; sy < bottom; sy++) {
+                            Decode(src.Row(sy), format, srcWidth, decoded.data(), tables);
+                            float* target = filtered.data() + size_t(sy - top) * rowPlanes;
+                            simd::Batch(size_t(dstWidth), [&](size_t x, auto lane) {
+                                using F = decltype(lane);
+                                F sum[4] = { F(0.0f), F(0.0f), F(0.0f), F(0.0f) };
+                                for (int k = 0; k < columns.taps; k++) {
+                                    F index = simd::Load<F>(columns.index.data() + size_t(k) * dstWidth + x);
+                                    F weight = simd::Load<F>(columns.weight.data() + size_t(k) * dstWidth + x);
+                                    for (int c = 0; c < channels; c++) sum[c] = sum[c] + simd::Gather(decoded.data() + size_t(c) * srcWidth, index) * weight;
+                                }
+                                for (int c = 0; c < channels; c++) simd::Store(sum[c], target + size_t(c) * dstWidth + x);
+                            });
+                        }
+
+                        // Vertical pass, one output row at a time.
+                        for (size_t y = y0; y < y1; y++) {
+                            const float* taps = filtered.data() + size_t(rows.first[y] - top) * rowPlanes;
+                            simd::Batch(rowPlanes, [&](size_t x, auto lane) {
+                                using F = decltype(lane);
+                                F sum(0.0f);
+                                for (int k = 0; k < rows.count[y]; k++)
+                                    sum = sum + simd::Load<F>(taps + size_t(k) * rowPlanes + x) * F(rows.weight[size_t(k) * dstHeight + y]);
+                                simd::Store(sum, result.data() + x);
+                            });
+                            Encode(result.data(), format, dstWidth, dst.Row(int(y)), tables);
+                        }
+                    }
+                };
+
+                size_t height = size_t(dstHeight);
+                if (pool && height >= 2 * size_t(parallelRows)) pool->ParallelFor(height, size_t(parallelRows), tile);
+                else tile(0, height);
+            }
+        };
+    }
+}
+#endif
@@ -0,0 +1,595 @@
+/*
+    SIMD lane types used by the batch kernels (VectorArray, etc.).
+
+    simd::Float holds as many floats as the widest enabled instruction set allows:
+        AVX2  -> 8 lanes (__m256)
+        SSE2  -> 4 lanes (__m128)
+        none  -> 1 lane  (float)
+
+    Define RAYLIB_PLUSPLUS_NO_SIMD before including to force the scalar fallback.
+    Half-float loads/stores use F16C when the compiler enables it (__F16C__, or AVX2 on MSVC).
+
+    Kernels are written once as generic lambdas and run through simd::Batch, which calls the
+    kernel with a simd::Float for the bulk of the range and with a plain float for the tail.
+    Every free function below is overloaded for both so the same kernel body compiles twice.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_SIMD
+#define RAYLIB_PLUSPLUS_SIMD
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if !defined(RAYLIB_PLUSPLUS_NO_SIMD)
+    #if defined(__AVX2__)
+        #define RAYLIB_PLUSPLUS_AVX2
+    #endif
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define RAYLIB_PLUSPLUS_SSE2
+    #endif
+    #if defined(RAYLIB_PLUSPLUS_SSE2) && (defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__)))
+        #define RAYLIB_PLUSPLUS_F16C
+    #endif
+#endif
+
+#if defined(RAYLIB_PLUSPLUS_AVX2) || defined(RAYLIB_PLUSPLUS_F16C)
+    #include <immintrin.h>
+#elif defined(RAYLIB_PLUSPLUS_SSE2)
+    #include <emmintrin.h>
+#endif
+
+namespace raylib {
+    namespace cpp {
+        namespace simd {
+            class Mask {
+            public:
+#if defined(RAYLIB_PLUSPLUS_AVX2)
+                __m256 v;
+                Mask(__m256 v) { this->v = v; }
+
+                Mask operator & (Mask m) const { return _mm256_and_ps(v, m.v); }
+                Mask operator | (Mask m) const { return _mm256_or_ps(v, m.v); }
+                Mask operator ! () const { return _mm256_xor_ps(v, _mm256_castsi256_ps(_mm256_set1_epi32(-1))); }
+
+                // One bit per lane, lane 0 in bit 0.
+                int Bits() const { return _mm256_movemask_ps(v); }
+#elif defined(RAYLIB_PLUSPLUS_SSE2)
+                __m128 v;
+                Mask(__m128 v) { this->v = v; }
+
+                Mask operator & (Mask m) const { return _mm_and_ps(v, m.v); }
+                Mask operator | (Mask m) const { return _mm_or_ps(v, m.v); }
+                Mask operator ! () const { return _mm_xor_ps(v, _mm_castsi128_ps(_mm_set1_epi32(-1))); }
+
+                int Bits() const { return _mm_movemask_ps(v); }
+#else
+                bool v;
+                Mask(bool v) { this->v = v; }
+
+                Mask operator & (Mask m) const { return v && m.v; }
+                Mask operator | (Mask m) const { return v || m.v; }
+                Mask operator ! () const { return !v; }
+
+                int Bits() const { return v ? 1 : 0; }
+#endif
+                bool Any() const { return Bits() != 0; }
+            };
+
+            class Float {
+            public:
+#if defined(RAYLIB_PLUSPLUS_AVX2)
+                static constexpr int Width = 8;
+                __m256 v;
+
+                Float() { v = _mm256_setzero_ps(); }
+                Float(float s) { v = _mm256_set1_ps(s); }
+                Float(__m256 v) { this->v = v; }
+
+                static Float Load(const float* p) { return _mm256_loadu_ps(p); }
+                void Store(float* p) const { _mm256_storeu_ps(p, v); }
+
+                Float operator + (Float f) const { return _mm256_add_ps(v, f.v); }
+                Float operator - (Float f) const { return _mm256_sub_ps(v, f.v); }
+                Float operator * (Float f) const { return _mm256_mul_ps(v, f.v); }
+                Float operator / (Float f) const { return _mm256_div_ps(v, f.v); }
+                Float operator - () const { return _mm256_xor_ps(v, _mm256_set1_ps(-0.0f)); }
+
+                Mask operator < (Float f) const { return _mm256_cmp_ps(v, f.v, _CMP_LT_OQ); }
+                Mask operator <= (Float f) const { return _mm256_cmp_ps(v, f.v, _CMP_LE_OQ); }
+                Mask operator > (Float f) const { return _mm256_cmp_ps(v, f.v, _CMP_GT_OQ); }
+                Mask operator >= (Float f) const { return _mm256_cmp_ps(v, f.v, _CMP_GE_OQ); }
+                Mask operator == (Float f) const { return _mm256_cmp_ps(v, f.v, _CMP_EQ_OQ); }
+                Mask operator != (Float f) const { return _mm256_cmp_ps(v, f.v, _CMP_NEQ_UQ); }
+#elif defined(RAYLIB_PLUSPLUS_SSE2)
+                static constexpr int Width = 4;
+                __m128 v;
+
+                Float() { v = _mm_setzero_ps(); }
+                Float(float s) { v = _mm_set1_ps(s); }
+                Float(__m128 v) { this->v = v; }
+
+                static Float Load(const float* p) { return _mm_loadu_ps(p); }
+                void Store(float* p) const { _mm_storeu_ps(p, v); }
+
+                Float operator + (Float f) const { return _mm_add_ps(v, f.v); }
+                Float operator - (Float f) const { return _mm_sub_ps(v, f.v); }
+                Float operator * (Float f) const { return _mm_mul_ps(v, f.v); }
+                Float operator / (Float f) const { return _mm_div_ps(v, f.v); }
+                Float operator - () const { return _mm_xor_ps(v, _mm_set1_ps(-0.0f)); }
+
+                Mask operator < (Float f) const { return _mm_cmplt_ps(v, f.v); }
+                Mask operator <= (Float f) const { return _mm_cmple_ps(v, f.v); }
+                Mask operator > (Float f) const { return _mm_cmpgt_ps(v, f.v); }
+                Mask operator >= (Float f) const { return _mm_cmpge_ps(v, f.v); }
+                Mask operator == (Float f) const { return _mm_cmpeq_ps(v, f.v); }
+                Mask operator != (Float f) const { return _mm_cmpneq_ps(v, f.v); }
+#else
+                static constexpr int Width = 1;
+                float v;
+
+                Float() { v = 0.0f; }
+                Float(float s) { v = s; }
+
+                static Float Load(const float* p) { return *p; }
+                void Store(float* p) const { *p = v; }
+
+                Float operator + (Float f) const { return v + f.v; }
+                Float operator - (Float f) const { return v - f.v; }
+                Float operator * (Float f) const { return v * f.v; }
+                Float operator / (Float f) const { return v / f.v; }
+                Float operator - () const { return -v; }
+
+                Mask operator < (Float f) const { return v < f.v; }
+                Mask operator <= (Float f) const { return v <= f.v; }
+                Mask operator > (Float f) const { return v > f.v; }
+                Mask operator >= (Float f) const { return v >= f.v; }
+                Mask operator == (Float f) const { return v == f.v; }
+                Mask operator != (Float f) const { return v != f.v; }
+#endif
+                Float& operator += (Float f) { return (*this) = (*this) + f; }
+                Float& operator -= (Float f) { return (*this) = (*this) - f; }
+                Float& operator *= (Float f) { return (*this) = (*this) * f; }
+                Float& operator /= (Float f) { return (*this) = (*this) / f; }
+
+                // Loads Width floats that are 'stride' floats apart (e.g. one member of an AoS array).
+                static Float LoadStrided(const float* p, size_t stride) {
+                    alignas(32) float lanes[Width];
+                    for (int i = 0; i < Width; i++) lanes[i] = p[i * stride];
+                    return Load(lanes);
+                }
+
+                void StoreStrided(float* p, size_t stride) const {
+                    alignas(32) float lanes[Width];
+                    Store(lanes);
+                    for (int i = 0; i < Width; i++) p[i * stride] = lanes[i];
+                }
+            };
+
+            inline Float Sqrt(Float f) {
+#if defined(RAYLIB_PLUSPLUS_AVX2)
+                return _mm256_sqrt_ps(f.v);
+#elif defined(RAYLIB_PLUSPLUS_SSE2)
+                return _mm_sqrt_ps(f.v);
+#else
+                return sqrtf(f.v);
+#endif
+            }
+
+            // Approximate 1 / sqrt(f), about 12 bits (exact when SIMD is disabled).
+            inline Float RSqrt(Float f) {
+#if defined(RAYLIB_PLUSPLUS_AVX2)
+                return _mm256_rsqrt_ps(f.v);
+#elif defined(RAYLIB_PLUSPLUS_SSE2)
+                return _mm_rsqrt_ps(f.v);
+#else
+                return 1.0f / sqrtf(f.v);
+#endif
+            }
+
+            inline Float Min(Float a, Float b) {
+#if defined(RAYLIB_PLUSPLUS_AVX2)
+                return _mm256_min_ps(a.v, b.v);
+#elif defined(RAYLIB_PLUSPLUS_SSE2)
+                return _mm_min_ps(a.v, b.v);
+#else
+                return (a.v < b.v) ? a.v : b.v;
+#endif
+            }
+
+            inline Float Max(Float a, Float b) {
+#if defined(RAYLIB_PLUSPLUS_AVX2)
+                return _mm256_max_ps(a.v, b.v);
+#elif defined(RAYLIB_PLUSPLUS_SSE2)
+                return _mm_max_ps(a.v, b.v);
+#else
+                return (a.v > b.v) ? a.v : b.v;
+#endif
+            }
+
+            inline Float Abs(Float f) {
+#if defined(RAYLIB_PLUSPLUS_AVX2)
+                return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), f.v);
+#elif defined(RAYLIB_PLUSPLUS_SSE2)
+                return _mm_andnot_ps(_mm_set1_ps(-0.0f), f.v);
+#else
+                return fabsf(f.v);
+#endif
+            }
+
+            // Lane-wise (m ? a : b).
+            inline Float Select(Mask m, Float a, Float b) {
+#if defined(RAYLIB_PLUSPLUS_AVX2)
+                return _mm256_blendv_ps(b.v, a.v, m.v);
+#elif defined(RAYLIB_PLUSPLUS_SSE2)
+                return _mm_or_ps(_mm_and_ps(m.v, a.v), _mm_andnot_ps(m.v, b.v));
+#else
+                return m.v ? a.v : b.v;
+#endif
+            }
+
+            inline Float Floor(Float f) {
+#if defined(RAYLIB_PLUSPLUS_AVX2)
+                return _mm256_floor_ps(f.v);
+#elif defined(RAYLIB_PLUSPLUS_SSE2)
+                // Truncate then step down for negative non-integers (valid for |f| < 2^31).
+                __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(f.v));
+                return _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, f.v), _mm_set1_ps(1.0f)));
+#else
+                return floorf(f.v);
+#endif
+            }
+
+            // Scalar overloads so kernels can be instantiated for the tail of a range.
+            inline float Sqrt(float f) { return sqrtf(f); }
+            inline float RSqrt(float f) {
+#if defined(RAYLIB_PLUSPLUS_SSE2)
+                return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(f)));
+#else
+                return 1.0f / sqrtf(f);
+#endif
+            }
+            inline float Min(float a, float b) { return (a < b) ? a : b; }
+            inline float Max(float a, float b) { return (a > b) ? a : b; }
+            inline float Abs(float f) { return fabsf(f); }
+            inline float Select(bool m, float a, float b) { return m ? a : b; }
+            inline float Floor(float f) { return floorf(f); }
+            inline int Bits(Mask m) { return m.Bits(); }
+            inline int Bits(bool m) { return m ? 1 : 0; }
+
+            template<typename F> inline F Load(const float* p) { return F::Load(p); }
+            template<> inline float Load<float>(const float* p) { return *p; }
+            inline void Store(Float f, float* p) { f.Store(p); }
+            inline void Store(float f, float* p) { *p = f; }
+
+            template<typename F> inline F LoadStrided(const float* p, size_t stride) { return F::LoadStrided(p, stride); }
+            template<> inline float LoadStrided<float>(const float* p, size_t) { return *p; }
+            inline void StoreStrided(Float f, float* p, size_t stride) { f.StoreStrided(p, stride); }
+            inline void StoreStrided(float f, float* p, size_t) { *p = f; }
+
+            // Lanes in F: Float::Width, or 1 for the scalar tail.
+            template<typename F> constexpr int Width() { return F::Width; }
+            template<> constexpr int Width<float>() { return 1; }
+
+            /*
+                16-bit integer lanes. Loads widen to float exactly. Stores truncate toward zero and
+                saturate to the 16-bit range, so round first (e.g. Floor(f + 0.5)) and keep inputs
+                within int32 range.
+            */
+            template<typename F> inline F Load(const int16_t* p) {
+#if defined(RAYLIB_PLUSPLUS_AVX2)
+                return _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))));
+#elif defined(RAYLIB_PLUSPLUS_SSE2)
+                __m128i i = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+                return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(i, i), 16));
+#else
+                return static_cast<float>(*p);
+#endif
+            }
+
+            template<typename F> inline F Load(const uint16_t* p) {
+#if defined(RAYLIB_PLUSPLUS_AVX2)
+                return _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))));
+#elif defined(RAYLIB_PLUSPLUS_SSE2)
+                __m128i i = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+                return _mm_cvtepi32_ps(_mm_unpacklo_epi16(i, _mm_setzero_si128()));
+#else
+                return static_cast<float>(*p);
+#endif
+            }
+
+            template<> inline float Load<float>(const int16_t* p) { return static_cast<float>(*p); }
+            template<> inline float Load<float>(const uint16_t* p) { return static_cast<float>(*p); }
+
+            inline void Store(float f, int16_t* p) {
+                int32_t i = static_cast<int32_t>(f);
+                *p = static_cast<int16_t>(i < -32768 ? -32768 : (i > 32767 ? 32767 : i));
+            }
+
+            inline void Store(float f, uint16_t* p) {
+                int32_t i = static_cast<int32_t>(f);
+                *p = static_cast<uint16_t>(i < 0 ? 0 : (i > 65535 ? 65535 : i));
+            }
+
+            inline void Store(Float f, int16_t* p) {
+#if defined(RAYLIB_PLUSPLUS_AVX2)
+                __m256i i = _mm256_cvttps_epi32(f.v);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm_packs_epi32(_mm256_castsi256_si128(i), _mm256_extracti128_si256(i, 1)));
+#elif defined(RAYLIB_PLUSPLUS_SSE2)
+                __m128i i = _mm_cvttps_epi32(f.v);
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_packs_epi32(i, i));
+#else
+                Store(f.v, p);
+#endif
+            }
+
+            inline void Store(Float f, uint16_t* p) {
+#if defined(RAYLIB_PLUSPLUS_AVX2)
+                __m256i i = _mm256_cvttps_epi32(f.v);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm_packus_epi32(_mm256_castsi256_si128(i), _mm256_extracti128_si256(i, 1)));
+#elif defined(RAYLIB_PLUSPLUS_SSE2)
+                // SSE2 only packs with signed saturation: shift into int16 range, pack, shift back.
+                __m128i i = _mm_sub_epi32(_mm_cvttps_epi32(f.v), _mm_set1_epi32(32768));
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_xor_si128(_mm_packs_epi32(i, i), _mm_set1_epi16(-32768)));
+#else
+                Store(f.v, p);
+#endif
+            }
+
+            // base[index] per lane; index holds exact non-negative integers. AVX2 uses a hardware gather.
+            inline float Gather(const float* base, float index) { return base[static_cast<int>(index)]; }
+
+            inline Float Gather(const float* base, Float index) {
+#if defined(RAYLIB_PLUSPLUS_AVX2)
+                return _mm256_i32gather_ps(base, _mm256_cvttps_epi32(index.v), 4);
+#elif defined(RAYLIB_PLUSPLUS_SSE2)
+                alignas(16) int32_t i[4];
+                _mm_store_si128(reinterpret_cast<__m128i*>(i), _mm_cvttps_epi32(index.v));
+                return _mm_setr_ps(base[i[0]], base[i[1]], base[i[2]], base[i[3]]);
+#else
+                return Gather(base, index.v);
+#endif
+            }
+
+            /*
+                RGBA8 pixel lanes: Width pixels of four 8-bit channels (r in the lowest byte) unpack to
+                one lane type per channel. Stores clamp to [0, 255] and truncate toward zero.
+            */
+            inline void LoadRgba8(const uint8_t* p, float& r, float& g, float& b, float& a) {
+                r = static_cast<float>(p[0]), g = static_cast<float>(p[1]), b = static_cast<float>(p[2]), a = static_cast<float>(p[3]);
+            }
+
+            inline void StoreRgba8(float r, float g, float b, float a, uint8_t* p) {
+                p[0] = static_cast<uint8_t>(Min(Max(r, 0.0f), 255.0f)), p[1] = static_cast<uint8_t>(Min(Max(g, 0.0f), 255.0f));
+                p[2] = static_cast<uint8_t>(Min(Max(b, 0.0f), 255.0f)), p[3] = static_cast<uint8_t>(Min(Max(a, 0.0f), 255.0f));
+            }
+
+            inline void LoadRgba8(const uint8_t* p, Float& r, Float& g, Float& b, Float& a) {
+#if defined(RAYLIB_PLUSPLUS_AVX2)
+                __m256i px = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), mask = _mm256_set1_epi32(0xFF);
+                r = _mm256_cvtepi32_ps(_mm256_and_si256(px, mask));
+                g = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(px, 8), mask));
+                b = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(px, 16), mask));
+                a = _mm256_cvtepi32_ps(_mm256_srli_epi32(px, 24));
+#elif defined(RAYLIB_PLUSPLUS_SSE2)
+                __m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), mask = _mm_set1_epi32(0xFF);
+                r = _mm_cvtepi32_ps(_mm_and_si128(px, mask));
+                g = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(px, 8), mask));
+                b = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(px, 16), mask));
+                a = _mm_cvtepi32_ps(_mm_srli_epi32(px, 24));
+#else
+                LoadRgba8(p, r.v, g.v, b.v, a.v);
+#endif
+            }
+
+            inline void StoreRgba8(Float r, Float g, Float b, Float a, uint8_t* p) {
+#if defined(RAYLIB_PLUSPLUS_AVX2)
+                auto byte = [](Float f) { return _mm256_cvttps_epi32(Min(Max(f, Float(0.0f)), Float(255.0f)).v); };
+                __m256i px = _mm256_or_si256(_mm256_or_si256(byte(r), _mm256_slli_epi32(byte(g), 8)), _mm256_or_si256(_mm256_slli_epi32(byte(b), 16), _mm256_slli_epi32(byte(a), 24)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), px);
+#elif defined(RAYLIB_PLUSPLUS_SSE2)
+                auto byte = [](Float f) { return _mm_cvttps_epi32(Min(Max(f, Float(0.0f)), Float(255.0f)).v); };
+                __m128i px = _mm_or_si128(_mm_or_si128(byte(r), _mm_slli_epi32(byte(g), 8)), _mm_or_si128(_mm_slli_epi32(byte(b), 16), _mm_slli_epi32(byte(a), 24)));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(p), px);
+#else
+                StoreRgba8(r.v, g.v, b.v, a.v, p);
+#endif
+            }
+
+            /*
+                2x2 box average of two RGBA8 rows into `pixels` output pixels: each output channel is
+                (four source values + 2) / 4. SSE2 does four output pixels per step in 16-bit lanes.
+            */
+            inline void AverageRgba8(const uint8_t* row0, const uint8_t* row1, uint8_t* out, size_t pixels) {
+                size_t x = 0;
+#if defined(RAYLIB_PLUSPLUS_SSE2)
+                __m128i zero = _mm_setzero_si128(), two = _mm_set1_epi16(2);
+                // Four source pixels from each row -> the two 2x2 sums, as 16-bit channels.
+                auto sums = [&](const uint8_t* a, const uint8_t* b) {
+                    __m128i pa = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a)), pb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+                    __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(pa, zero), _mm_unpacklo_epi8(pb, zero));
+                    __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(pa, zero), _mm_unpackhi_epi8(pb, zero));
+                    lo = _mm_add_epi16(lo, _mm_srli_si128(lo, 8)), hi = _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
+                    return _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(lo, hi), two), 2);
+                };
+                for (; x + 4 <= pixels; x += 4) {
+                    __m128i first = sums(row0 + x * 8, row1 + x * 8), second = sums(row0 + x * 8 + 16, row1 + x * 8 + 16);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x * 4), _mm_packus_epi16(first, second));
+                }
+#endif
+                for (; x < pixels; x++)
+                    for (int c = 0; c < 4; c++)
+                        out[x * 4 + c] = static_cast<uint8_t>((row0[x * 8 + c] + row0[x * 8 + 4 + c] + row1[x * 8 + c] + row1[x * 8 + 4 + c] + 2) >> 2);
+            }
+
+            // IEEE 754 binary16 conversion, rounding to nearest even. Overflow becomes infinity.
+            inline uint16_t FloatToHalf(float f) {
+                uint32_t x;
+                memcpy(&x, &f, sizeof(x));
+                uint32_t sign = (x >> 16) & 0x8000u;
+                x &= 0x7FFFFFFFu;
+
+                if (x >= 0x47800000u) return static_cast<uint16_t>(sign | (x > 0x7F800000u ? 0x7E00u : 0x7C00u));
+
+                if (x < 0x38800000u) {
+                    // Subnormal or zero: let the float adder do the rounding.
+                    float magnitude;
+                    memcpy(&magnitude, &x, sizeof(x));
+                    magnitude += 0.5f;
+                    memcpy(&x, &magnitude, sizeof(x));
+                    return static_cast<uint16_t>(sign | (x - 0x3F000000u));
+                }
+
+                // Rebias the exponent (127 -> 15) and round the 13 dropped mantissa bits.
+                x += 0xC8000FFFu + ((x >> 13) & 1u);
+                return static_cast<uint16_t>(sign | (x >> 13));
+            }
+
+            inline float HalfToFloat(uint16_t h) {
+                uint32_t sign = (h & 0x8000u) << 16, magnitude = h & 0x7FFFu, x;
+
+                if (magnitude >= 0x7C00u) {
+                    x = 0x7F800000u | ((magnitude & 0x3FFu) << 13);
+                } else if (magnitude >= 0x0400u) {
+                    x = (magnitude << 13) + 0x38000000u;
+                } else {
+                    float f = static_cast<float>(magnitude) * 5.9604644775390625e-8f;    // * 2^-24
+                    memcpy(&x, &f, sizeof(x));
+                }
+
+                x |= sign;
+                float f;
+                memcpy(&f, &x, sizeof(f));
+                return f;
+            }
+
+            template<typename F> inline F LoadHalf(const uint16_t* p) {
+#if defined(RAYLIB_PLUSPLUS_F16C) && defined(RAYLIB_PLUSPLUS_AVX2)
+                return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+#elif defined(RAYLIB_PLUSPLUS_F16C)
+                return _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+#else
+                alignas(32) float lanes[Float::Width];
+                for (int i = 0; i < Float::Width; i++) lanes[i] = HalfToFloat(p[i]);
+                return Float::Load(lanes);
+#endif
+            }
+
+            template<> inline float LoadHalf<float>(const uint16_t* p) { return HalfToFloat(*p); }
+
+            inline void StoreHalf(Float f, uint16_t* p) {
+#if defined(RAYLIB_PLUSPLUS_F16C) && defined(RAYLIB_PLUSPLUS_AVX2)
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm256_cvtps_ph(f.v, _MM_FROUND_TO_NEAREST_INT));
+#elif defined(RAYLIB_PLUSPLUS_F16C)
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_cvtps_ph(f.v, _MM_FROUND_TO_NEAREST_INT));
+#else
+                alignas(32) float lanes[Float::Width];
+                f.Store(lanes);
+                for (int i = 0; i < Float::Width; i++) p[i] = FloatToHalf(lanes[i]);
+#endif
+            }
+
+            inline void StoreHalf(float f, uint16_t* p) { *p = FloatToHalf(f); }
+
+            /*
+                Runs kernel(i, lane) over [0, count): 'lane' is a simd::Float for every full group of
+                Float::Width elements starting at i, then a float for each remaining element.
+            */
+            template<typename Kernel>
+            inline void Batch(size_t count, Kernel&& kernel) {
+                size_t i = 0;
+                for (; i + Float::Width <= count; i += Float::Width)
+                    kernel(i, Float());
+                for (; i < count; i++)
+                    kernel(i, 0.0f);
+            }
+
+            /*
+                Exactly four lanes (one matrix row / one xyzw vector), SSE2 when available.
+                AVX2 builds use the VEX-encoded 128-bit forms of the same instructions.
+            */
+            class Float4 {
+            public:
+#if defined(RAYLIB_PLUSPLUS_SSE2)
+                __m128 v;
+
+                Float4() { v = _mm_setzero_ps(); }
+                Float4(float s) { v = _mm_set1_ps(s); }
+                Float4(float x, float y, float z, float w) { v = _mm_setr_ps(x, y, z, w); }
+                Float4(__m128 v) { this->v = v; }
+
+                static Float4 Load(const float* p) { return _mm_loadu_ps(p); }
+                static Float4 LoadAligned(const float* p) { return _mm_load_ps(p); }
+                void Store(float* p) const { _mm_storeu_ps(p, v); }
+                void StoreAligned(float* p) const { _mm_store_ps(p, v); }
+
+                Float4 operator + (Float4 f) const { return _mm_add_ps(v, f.v); }
+                Float4 operator - (Float4 f) const { return _mm_sub_ps(v, f.v); }
+                Float4 operator * (Float4 f) const { return _mm_mul_ps(v, f.v); }
+                Float4 operator / (Float4 f) const { return _mm_div_ps(v, f.v); }
+                Float4 operator - () const { return _mm_xor_ps(v, _mm_set1_ps(-0.0f)); }
+
+                // Result lane i = lane I<i> of this.
+                template<int I0, int I1, int I2, int I3>
+                Float4 Shuffle() const { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(I3, I2, I1, I0)); }
+
+                float Lane0() const { return _mm_cvtss_f32(v); }
+
+                static void Transpose(Float4& r0, Float4& r1, Float4& r2, Float4& r3) {
+                    _MM_TRANSPOSE4_PS(r0.v, r1.v, r2.v, r3.v);
+                }
+#else
+                float v[4];
+
+                Float4() { v[0] = v[1] = v[2] = v[3] = 0.0f; }
+                Float4(float s) { v[0] = v[1] = v[2] = v[3] = s; }
+                Float4(float x, float y, float z, float w) { v[0] = x, v[1] = y, v[2] = z, v[3] = w; }
+
+                static Float4 Load(const float* p) { return Float4(p[0], p[1], p[2], p[3]); }
+                static Float4 LoadAligned(const float* p) { return Load(p); }
+                void Store(float* p) const { p[0] = v[0], p[1] = v[1], p[2] = v[2], p[3] = v[3]; }
+                void StoreAligned(float* p) const { Store(p); }
+
+                Float4 operator + (Float4 f) const { return Float4(v[0] + f.v[0], v[1] + f.v[1], v[2] + f.v[2], v[3] + f.v[3]); }
+                Float4 operator - (Float4 f) const { return Float4(v[0] - f.v[0], v[1] - f.v[1], v[2] - f.v[2], v[3] - f.v[3]); }
+                Float4 operator * (Float4 f) const { return Float4(v[0] * f.v[0], v[1] * f.v[1], v[2] * f.v[2], v[3] * f.v[3]); }
+                Float4 operator / (Float4 f) const { return Float4(v[0] / f.v[0], v[1] / f.v[1], v[2] / f.v[2], v[3] / f.v[3]); }
+                Float4 operator - () const { return Float4(-v[0], -v[1], -v[2], -v[3]); }
+
+                template<int I0, int I1, int I2, int I3>
+                Float4 Shuffle() const { return Float4(v[I0], v[I1], v[I2], v[I3]); }
+
+                float Lane0() const { return v[0]; }
+
+                static void Transpose(Float4& r0, Float4& r1, Float4& r2, Float4& r3) {
+                    Float4 t0(r0.v[0], r1.v[0], r2.v[0], r3.v[0]);
+                    Float4 t1(r0.v[1], r1.v[1], r2.v[1], r3.v[1]);
+                    Float4 t2(r0.v[2], r1.v[2], r2.v[2], r3.v[2]);
+                    Float4 t3(r0.v[3], r1.v[3], r2.v[3], r3.v[3]);
+                    r0 = t0, r1 = t1, r2 = t2, r3 = t3;
+                }
+#endif
+                // Broadcast lane I to all four lanes.
+                template<int I>
+                Float4 Splat() const { return Shuffle<I, I, I, I>(); }
+
+                // xyz cross product, w lane becomes w*w' - w*w' (0 for finite input).
+                Float4 Cross3(Float4 f) const {
+                    return Shuffle<1, 2, 0, 3>() * f.Shuffle<2, 0, 1, 3>() - Shuffle<2, 0, 1, 3>() * f.Shuffle<1, 2, 0, 3>();
+                }
+
+                float Dot3(Float4 f) const {
+                    Float4 p = (*this) * f;
+                    return p.Lane0() + p.Splat<1>().Lane0() + p.Splat<2>().Lane0();
+                }
+
+                // Summed as ((x + y) + z) + w, the same order as the scalar raymath code.
+                float Dot4(Float4 f) const {
+                    Float4 p = (*this) * f;
+                    return p.Lane0() + p.Splat<1>().Lane0() + p.Splat<2>().Lane0() + p.Splat<3>().Lane0();
+                }
+            };
+        }
+    }
+}
+#endif
@@ -0,0 +1,153 @@
+/*
+    SimdMatrix: 16-byte aligned 4x4 matrix stored as four simd::Float4 rows.
+
+    Row r holds { m(r), m(r+4), m(r+8), m(r+12) }, which is exactly the memory layout of raylib's
+    ::Matrix (m0, m4, m8, m12, m1, ...), so AsMatrix() hands the data to raylib without a copy.
+
+    Multiply follows raymath's MatrixMultiply(left, right) convention (transform by left, then by
+    right) and sums the products in the same order, so the result matches raymath bit for bit.
+    Invert uses a cross-product fast path when the bottom row is (0, 0, 0, 1) and otherwise falls
+    back to the raymath cofactor formula from Vector.hpp.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_SIMD_MATRIX
+#define RAYLIB_PLUSPLUS_SIMD_MATRIX
+#include "./RaylibExtern.hpp"
+#include "./Vector.hpp"
+#include "./Simd.hpp"
+#include <cstddef>
+
+namespace raylib {
+    namespace cpp {
+        class alignas(16) SimdMatrix {
+        public:
+            simd::Float4 rows[4];
+
+            SimdMatrix() {
+                rows[0] = simd::Float4(), rows[1] = simd::Float4();
+                rows[2] = simd::Float4(), rows[3] = simd::Float4();
+            }
+
+            SimdMatrix(simd::Float4 r0, simd::Float4 r1, simd::Float4 r2, simd::Float4 r3) {
+                rows[0] = r0, rows[1] = r1, rows[2] = r2, rows[3] = r3;
+            }
+
+            SimdMatrix(const ::Matrix& m) { Set(reinterpret_cast<const float*>(&m)); }
+            SimdMatrix(const Matrix& m) { Set(reinterpret_cast<const float*>(&m)); }
+
+            operator Matrix() const { return reinterpret_cast<const Matrix&>(*this); }
+            operator ::Matrix() const { return AsMatrix(); }
+
+            // Zero-copy views for passing to raylib/raymath or the Matrix wrapper.
+            const ::Matrix& AsMatrix() const { return reinterpret_cast<const ::Matrix&>(*this); }
+            ::Matrix& AsMatrix() { return reinterpret_cast<::Matrix&>(*this); }
+            const float* Data() const { return reinterpret_cast<const float*>(this); }
+
+            // Loads 16 floats in ::Matrix memory order (m0, m4, m8, m12, m1, ...).
+            SimdMatrix& Set(const float* p) {
+                rows[0] = simd::Float4::Load(p), rows[1] = simd::Float4::Load(p + 4);
+                rows[2] = simd::Float4::Load(p + 8), rows[3] = simd::Float4::Load(p + 12);
+                return (*this);
+            }
+
+            static SimdMatrix MatrixIdentity() {
+                return SimdMatrix(
+                    simd::Float4(1.0f, 0.0f, 0.0f, 0.0f), simd::Float4(0.0f, 1.0f, 0.0f, 0.0f),
+                    simd::Float4(0.0f, 0.0f, 1.0f, 0.0f), simd::Float4(0.0f, 0.0f, 0.0f, 1.0f));
+            }
+            SimdMatrix& Identity() {
+                return (*this) = MatrixIdentity();
+            }
+
+            static SimdMatrix Multiply(const SimdMatrix& left, const SimdMatrix& right) {
+                SimdMatrix result;
+                for (int r = 0; r < 4; r++) {
+                    simd::Float4 row = right.rows[r];
+                    result.rows[r] = row.Splat<0>() * left.rows[0] + row.Splat<1>() * left.rows[1]
+                        + row.Splat<2>() * left.rows[2] + row.Splat<3>() * left.rows[3];
+                }
+                return result;
+            }
+            SimdMatrix& Multiply(const SimdMatrix& right) {
+                return (*this) = Multiply(*this, right);
+            }
+
+            SimdMatrix operator * (const SimdMatrix& right) const { return Multiply(*this, right); }
+            SimdMatrix& operator *= (const SimdMatrix& right) { return Multiply(right); }
+
+            // out[i] = MatrixMultiply(left[i], right[i]) for i in [0, count).
+            static void MultiplyMany(const SimdMatrix* left, const SimdMatrix* right, SimdMatrix* out, size_t count) {
+                for (size_t i = 0; i < count; i++)
+                    out[i] = Multiply(left[i], right[i]);
+            }
+
+            // out[i] = MatrixMultiply(left[i], right): e.g. many local matrices into one parent space.
+            static void MultiplyMany(const SimdMatrix* left, const SimdMatrix& right, SimdMatrix* out, size_t count) {
+                simd::Float4 r[4][4];
+                for (int j = 0; j < 4; j++) {
+                    r[j][0] = right.rows[j].Splat<0>(), r[j][1] = right.rows[j].Splat<1>();
+                    r[j][2] = right.rows[j].Splat<2>(), r[j][3] = right.rows[j].Splat<3>();
+                }
+
+                for (size_t i = 0; i < count; i++) {
+                    const simd::Float4* l = left[i].rows;
+                    for (int j = 0; j < 4; j++)
+                        out[i].rows[j] = r[j][0] * l[0] + r[j][1] * l[1] + r[j][2] * l[2] + r[j][3] * l[3];
+                }
+            }
+
+            SimdMatrix& Transpose() {
+                simd::Float4::Transpose(rows[0], rows[1], rows[2], rows[3]);
+                return (*this);
+            }
+
+            // True when the bottom row (m3, m7, m11, m15) is (0, 0, 0, 1).
+            bool IsAffine() const {
+                alignas(16) float bottom[4];
+                rows[3].StoreAligned(bottom);
+                return bottom[0] == 0.0f && bottom[1] == 0.0f && bottom[2] == 0.0f && bottom[3] == 1.0f;
+            }
+
+            SimdMatrix& Invert() {
+                if (!IsAffine()) {
+                    Matrix m = (*this);
+                    return (*this) = SimdMatrix(m.Invert());
+                }
+
+                return InvertAffine();
+            }
+
+            /*
+                Inverse of [A t; 0 1] is [A^-1  -A^-1 t; 0 1]. The columns of A^-1 are the cross
+                products of A's rows divided by det(A), then a transpose turns them back into rows.
+                Only valid when IsAffine() holds.
+            */
+            SimdMatrix& InvertAffine() {
+                simd::Float4 c0 = rows[1].Cross3(rows[2]);
+                simd::Float4 c1 = rows[2].Cross3(rows[0]);
+                simd::Float4 c2 = rows[0].Cross3(rows[1]);
+
+                simd::Float4 invDet(1.0f / rows[0].Dot3(c0));
+                c0 = c0 * invDet, c1 = c1 * invDet, c2 = c2 * invDet;
+
+                // Translation column t = (m12, m13, m14) sits in lane 3 of the first three rows.
+                simd::Float4 t = -(c0 * rows[0].Splat<3>() + c1 * rows[1].Splat<3>() + c2 * rows[2].Splat<3>());
+
+                simd::Float4 bottom(0.0f, 0.0f, 0.0f, 1.0f);
+                simd::Float4::Transpose(c0, c1, c2, t);
+                rows[0] = c0, rows[1] = c1, rows[2] = c2, rows[3] = bottom;
+                return (*this);
+            }
+
+            Vector3D Transform(Vector3D v) const {
+                alignas(16) float r[4][4];
+                for (int i = 0; i < 3; i++) rows[i].StoreAligned(r[i]);
+                return Vector3D(
+                    r[0][0] * v.x + r[0][1] * v.y + r[0][2] * v.z + r[0][3],
+                    r[1][0] * v.x + r[1][1] * v.y + r[1][2] * v.z + r[1][3],
+                    r[2][0] * v.x + r[2][1] * v.y + r[2][2] * v.z + r[2][3]);
+            }
+        };
+    }
+}
+#endif
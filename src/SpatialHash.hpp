@@ -0,0 +1,330 @@
+/*
+    SpatialHash: hashed uniform grid for 2D broadphase queries.
+
+    Entities are Rectangles (or Vector2D points, stored as zero-size rectangles) identified by the
+    id returned from Insert(). Each entity is listed in every cell its bounds touch. Cells live in
+    one array and are found through an open-addressing table with a power-of-two slot count, so
+    the grid is unbounded and only occupied cells use memory. Each cell stores its entities'
+    bounds next to their ids, so queries scan contiguous memory without looking entities up.
+
+        SpatialHash grid(64.0f);                            // cell size in world units
+        uint32_t id = grid.Insert(Rectangle(x, y, w, h));
+        grid.Move(id, Rectangle(x + dx, y + dy, w, h));     // cheap when the covered cells don't change
+        grid.QueryRadius(center, 100.0f, found);
+        grid.ForEachPair([&](uint32_t a, uint32_t b) { ... });
+
+    An entity that spans several cells is reported once per query and once per pair: only the
+    cell at the minimum corner of the overlap of the two cell ranges reports it.
+    Overlap follows CheckCollisionRecs (touching edges do not overlap).
+
+    Pick a cell size around the size of a typical entity. Cells that become empty are kept for
+    reuse; Clear() drops everything.
+
+    Cell coordinates are clamped to +-2^30 (NaN maps to cell 0). Entities covering more than
+    maxEntityCells cells are not listed in cells at all: they are kept on a separate list that
+    queries and ForEachPair test directly. A query range larger than the number of occupied cells
+    walks the occupied cells instead of the range, so huge rectangles and radii stay cheap.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_SPATIAL_HASH
+#define RAYLIB_PLUSPLUS_SPATIAL_HASH
+#include "./RaylibExtern.hpp"
+#include "./Vector.hpp"
+#include "./Textures.hpp"
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace raylib {
+    namespace cpp {
+        class SpatialHash {
+        private:
+            static constexpr uint32_t Empty = 0xFFFFFFFFu;
+            static constexpr float CellLimit = 1073741824.0f;
+
+            struct Item {
+                Rectangle bounds;
+                uint32_t id;
+            };
+
+            struct Cell {
+                int32_t x, y;
+                std::vector<Item> items;
+            };
+
+            // Inclusive cell range covered by some bounds.
+            struct CellRange {
+                int32_t x0, y0, x1, y1;
+                bool operator == (const CellRange& r) const { return x0 == r.x0 && y0 == r.y0 && x1 == r.x1 && y1 == r.y1; }
+            };
+
+            struct Entity {
+                Rectangle bounds;
+                CellRange range;
+                bool alive, large;
+            };
+
+            float cellSize, inverseCellSize;
+            std::vector<Cell> cells;
+            std::vector<uint32_t> slots;        // Power-of-two open-addressing table of cell indices.
+            std::vector<Entity> entities;
+            std::vector<uint32_t> freeIds;
+            std::vector<uint32_t> large;        // Entities over maxEntityCells, kept out of the cells.
+            size_t count = 0;
+
+            static uint32_t Hash(int32_t x, int32_t y) {
+                uint32_t h = static_cast<uint32_t>(x) * 0x9E3779B1u ^ static_cast<uint32_t>(y) * 0x85EBCA77u;
+                return h ^ (h >> 15);
+            }
+
+            // Clamped so the cast is defined and range loops cannot overflow.
+            int32_t CellCoord(float v) const {
+                float c = floorf(v * inverseCellSize);
+                if (c != c) return 0;
+                return static_cast<int32_t>(c < -CellLimit ? -CellLimit : (c > CellLimit ? CellLimit : c));
+            }
+
+            static uint64_t CellsIn(const CellRange& r) {
+                if (r.x1 < r.x0 || r.y1 < r.y0) return 0;
+                return uint64_t(int64_t(r.x1) - r.x0 + 1) * uint64_t(int64_t(r.y1) - r.y0 + 1);
+            }
+
+            CellRange RangeOf(const Rectangle& r) const {
+                return { CellCoord(r.x), CellCoord(r.y), CellCoord(r.x + r.w), CellCoord(r.y + r.h) };
+            }
+
+            static bool Overlaps(const Rectangle& a, const Rectangle& b) {
+                return a.x < b.x + b.w && a.x + a.w > b.x && a.y < b.y + b.h && a.y + a.h > b.y;
+            }
+
+            static bool Overlaps(const Rectangle& r, Vector2D center, float radiusSq) {
+                float cx = center.x < r.x ? r.x : (center.x > r.x + r.w ? r.x + r.w : center.x);
+                float cy = center.y < r.y ? r.y : (center.y > r.y + r.h ? r.y + r.h : center.y);
+                float dx = cx - center.x, dy = cy - center.y;
+                return dx * dx + dy * dy <= radiusSq;
+            }
+
+            uint32_t FindCell(int32_t x, int32_t y) const {
+                if (slots.empty()) return Empty;
+                uint32_t mask = static_cast<uint32_t>(slots.size() - 1);
+                for (uint32_t slot = Hash(x, y) & mask;; slot = (slot + 1) & mask) {
+                    uint32_t cell = slots[slot];
+                    if (cell == Empty || (cells[cell].x == x && cells[cell].y == y)) return cell;
+                }
+            }
+
+            void Rehash(size_t slotCount) {
+                slots.assign(slotCount, Empty);
+                uint32_t mask = static_cast<uint32_t>(slotCount - 1);
+                for (uint32_t cell = 0; cell < cells.size(); cell++) {
+                    uint32_t slot = Hash(cells[cell].x, cells[cell].y) & mask;
+                    while (slots[slot] != Empty) slot = (slot + 1) & mask;
+                    slots[slot] = cell;
+                }
+            }
+
+            Cell& GetOrCreateCell(int32_t x, int32_t y) {
+                uint32_t cell = FindCell(x, y);
+                if (cell != Empty) return cells[cell];
+
+                // Keep the table at most half full.
+                if ((cells.size() + 1) * 2 > slots.size())
+                    Rehash(slots.empty() ? 64 : slots.size() * 2);
+
+                uint32_t mask = static_cast<uint32_t>(slots.size() - 1), slot = Hash(x, y) & mask;
+                while (slots[slot] != Empty) slot = (slot + 1) & mask;
+                slots[slot] = static_cast<uint32_t>(cells.size());
+                cells.push_back({ x, y, {} });
+                return cells.back();
+            }
+
+            void AddToCells(uint32_t id, const Rectangle& bounds, const CellRange& r) {
+                for (int32_t y = r.y0; y <= r.y1; y++)
+                    for (int32_t x = r.x0; x <= r.x1; x++)
+                        GetOrCreateCell(x, y).items.push_back({ bounds, id });
+            }
+
+            void RemoveFromCells(uint32_t id, const CellRange& r) {
+                for (int32_t y = r.y0; y <= r.y1; y++)
+                    for (int32_t x = r.x0; x <= r.x1; x++) {
+                        std::vector<Item>& items = cells[FindCell(x, y)].items;
+                        for (size_t i = 0; i < items.size(); i++)
+                            if (items[i].id == id) {
+                                items[i] = items.back();
+                                items.pop_back();
+                                break;
+                            }
+                    }
+            }
+
+            // Lists an entity in its cells, or on the large list if it covers too many.
+            void Link(uint32_t id) {
+                Entity& entity = entities[id];
+                entity.large = CellsIn(entity.range) > maxEntityCells;
+                if (entity.large) large.push_back(id);
+                else AddToCells(id, entity.bounds, entity.range);
+            }
+
+            void Unlink(uint32_t id) {
+                if (!entities[id].large) {
+                    RemoveFromCells(id, entities[id].range);
+                    return;
+                }
+                for (size_t i = 0; i < large.size(); i++)
+                    if (large[i] == id) {
+                        large[i] = large.back();
+                        large.pop_back();
+                        break;
+                    }
+            }
+
+            // Calls visit(item) once per entity in the cells of range, skipping duplicates of multi-cell entities.
+            template<typename F>
+            void Visit(const CellRange& q, F&& visit) const {
+                auto visitCell = [&](const Cell& cell) {
+                    for (const Item& item : cell.items) {
+                        const CellRange& e = entities[item.id].range;
+                        if (cell.x != (e.x0 > q.x0 ? e.x0 : q.x0) || cell.y != (e.y0 > q.y0 ? e.y0 : q.y0)) continue;
+                        visit(item);
+                    }
+                };
+
+                if (CellsIn(q) > cells.size()) {
+                    // Fewer occupied cells than cells in range: walk those instead.
+                    for (const Cell& cell : cells)
+                        if (cell.x >= q.x0 && cell.x <= q.x1 && cell.y >= q.y0 && cell.y <= q.y1) visitCell(cell);
+                } else {
+                    for (int32_t y = q.y0; y <= q.y1; y++)
+                        for (int32_t x = q.x0; x <= q.x1; x++) {
+                            uint32_t cell = FindCell(x, y);
+                            if (cell != Empty) visitCell(cells[cell]);
+                        }
+                }
+
+                for (uint32_t id : large) visit(Item { entities[id].bounds, id });
+            }
+
+        public:
+            // Entities covering more cells than this skip the grid (see the large list).
+            static constexpr uint64_t maxEntityCells = 1024;
+
+            SpatialHash(float cellSize = 64.0f) : cellSize(cellSize), inverseCellSize(1.0f / cellSize) {}
+
+            float GetCellSize() const { return cellSize; }
+            size_t Size() const { return count; }
+            size_t CellCount() const { return cells.size(); }
+
+            void Clear() {
+                cells.clear(), slots.clear(), entities.clear(), freeIds.clear(), large.clear();
+                count = 0;
+            }
+
+            uint32_t Insert(Rectangle bounds) {
+                uint32_t id;
+                if (!freeIds.empty()) {
+                    id = freeIds.back();
+                    freeIds.pop_back();
+                } else {
+                    id = static_cast<uint32_t>(entities.size());
+                    entities.push_back({});
+                }
+
+                entities[id] = { bounds, RangeOf(bounds), true, false };
+                Link(id);
+                count++;
+                return id;
+            }
+
+            uint32_t Insert(Vector2D point) { return Insert(Rectangle(point.x, point.y, 0.0f, 0.0f)); }
+
+            void Move(uint32_t id, Rectangle bounds) {
+                Entity& entity = entities[id];
+                if (!entity.alive) return;
+
+                CellRange range = RangeOf(bounds);
+                entity.bounds = bounds;
+
+                if (range == entity.range) {
+                    if (entity.large) return;
+                    // Same cells: only refresh the stored bounds.
+                    for (int32_t y = range.y0; y <= range.y1; y++)
+                        for (int32_t x = range.x0; x <= range.x1; x++)
+                            for (Item& item : cells[FindCell(x, y)].items)
+                                if (item.id == id) {
+                                    item.bounds = bounds;
+                                    break;
+                                }
+                    return;
+                }
+
+                Unlink(id);
+                entity.range = range;
+                Link(id);
+            }
+
+            void Move(uint32_t id, Vector2D point) { Move(id, Rectangle(point.x, point.y, 0.0f, 0.0f)); }
+
+            void Remove(uint32_t id) {
+                Entity& entity = entities[id];
+                if (!entity.alive) return;
+
+                Unlink(id);
+                entity.alive = false;
+                freeIds.push_back(id);
+                count--;
+            }
+
+            bool Contains(uint32_t id) const { return id < entities.size() && entities[id].alive; }
+            Rectangle GetBounds(uint32_t id) const { return entities[id].bounds; }
+
+            // Appends the ids of entities overlapping area to out.
+            void QueryRect(Rectangle area, std::vector<uint32_t>& out) const {
+                Visit(RangeOf(area), [&](const Item& item) {
+                    if (Overlaps(item.bounds, area)) out.push_back(item.id);
+                });
+            }
+
+            // Appends the ids of entities within radius of center (any part of their bounds) to out.
+            void QueryRadius(Vector2D center, float radius, std::vector<uint32_t>& out) const {
+                float radiusSq = radius * radius;
+                Visit(RangeOf(Rectangle(center.x - radius, center.y - radius, 2.0f * radius, 2.0f * radius)), [&](const Item& item) {
+                    if (Overlaps(item.bounds, center, radiusSq)) out.push_back(item.id);
+                });
+            }
+
+            // Calls pair(a, b) once for every pair of overlapping entities.
+            template<typename F>
+            void ForEachPair(F&& pair) const {
+                for (const Cell& cell : cells) {
+                    const std::vector<Item>& items = cell.items;
+                    for (size_t i = 0; i < items.size(); i++) {
+                        const CellRange& a = entities[items[i].id].range;
+
+                        for (size_t j = i + 1; j < items.size(); j++) {
+                            if (!Overlaps(items[i].bounds, items[j].bounds)) continue;
+
+                            // Report only from the min corner of the two ranges' intersection.
+                            const CellRange& b = entities[items[j].id].range;
+                            if (cell.x != (a.x0 > b.x0 ? a.x0 : b.x0) || cell.y != (a.y0 > b.y0 ? a.y0 : b.y0)) continue;
+                            pair(items[i].id, items[j].id);
+                        }
+                    }
+                }
+
+                // Large entities are in no cell: test them against every other live entity.
+                for (uint32_t a : large)
+                    for (uint32_t b = 0; b < entities.size(); b++) {
+                        const Entity& other = entities[b];
+                        if (!other.alive || b == a || (other.large && b < a)) continue;
+                        if (Overlaps(entities[a].bounds, other.bounds)) pair(a, b);
+                    }
+            }
+
+            void QueryPairs(std::vector<std::pair<uint32_t, uint32_t>>& out) const {
+                ForEachPair([&](uint32_t a, uint32_t b) { out.emplace_back(a, b); });
+            }
+        };
+    }
+}
+#endif
@@ -0,0 +1,270 @@
+/*
+    Packs many small images into a few large RGBA8 pages, so sprites drawn from one page share a
+    texture and do not break raylib's draw batch on every texture switch.
+
+        TextureAtlas atlas(2048, 2048);
+        atlas.Add("coin", coin.View());
+        atlas.Add(sprites, &pool);                      // many at once, packed tallest first
+        ...
+        atlas.Draw("coin", Rectangle(x, y, 32, 32), Vector2D(16, 16), angle, WHITE);
+
+    Placement is skyline bottom-left (SkylinePacker): each rectangle goes where its top edge ends
+    lowest, which keeps a packed page close to full for sprite-sized rectangles. Add places sprites
+    one at a time as they arrive, so an atlas can keep growing at runtime; a page is added when no
+    existing page has room. The batch Add sorts by height first, which packs noticeably tighter,
+    and copies the pixels across the pool.
+
+    Every sprite gets `padding` empty pixels to its right and bottom, and its edge pixels are repeated
+    `extrude` pixels outwards, so bilinear filtering and mipmaps do not pick up the neighbours. Find
+    returns the sprite's rectangle on its page, without the extrusion. Sources in other uncompressed
+    formats are converted to RGBA8 on the way in.
+
+    Pages live in CPU memory. Texture(page) uploads a page the first time and again after it changes
+    (on the render thread); the atlas unloads its textures when it is destroyed.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_TEXTURE_ATLAS
+#define RAYLIB_PLUSPLUS_TEXTURE_ATLAS
+#include "./RaylibExtern.hpp"
+#include "./Colors.hpp"
+#include "./ImageView.hpp"
+#include "./PixelConvert.hpp"
+#include "./ThreadPool.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace raylib {
+    namespace cpp {
+        class SkylinePacker {
+        private:
+            struct Node { int x, y, width; };
+            int width, height;
+            std::vector<Node> skyline;
+
+            // Top of a w * h rectangle whose left edge sits on node i, or -1 if it does not fit there.
+            int Fit(size_t i, int w, int h) const {
+                if (skyline[i].x + w > width) return -1;
+                int y = skyline[i].y;
+                for (int remaining = w; remaining > 0; remaining -= skyline[i].width, i++) {
+                    y = skyline[i].y > y ? skyline[i].y : y;
+                    if (y + h > height) return -1;
+                }
+                return y;
+            }
+
+        public:
+            SkylinePacker(int width, int height) : width(width), height(height), skyline { { 0, 0, width } } {}
+
+            int Width() const { return width; }
+            int Height() const { return height; }
+
+            // Places a w * h rectangle at the lowest top edge (then the narrowest node); false if it does not fit.
+            bool Insert(int w, int h, int& x, int& y) {
+                if (w <= 0 || h <= 0) return false;
+                size_t best = skyline.size();
+                int bestTop = INT_MAX, bestWidth = INT_MAX, bestY = 0;
+                for (size_t i = 0; i < skyline.size(); i++) {
+                    int top = Fit(i, w, h);
+                    if (top < 0) continue;
+                    if (top + h < bestTop || (top + h == bestTop && skyline[i].width < bestWidth))
+                        best = i, bestTop = top + h, bestWidth = skyline[i].width, bestY = top;
+                }
+                if (best == skyline.size()) return false;
+
+                x = skyline[best].x, y = bestY;
+                skyline.insert(skyline.begin() + best, Node { x, y + h, w });
+                // Cut the nodes now covered by the new one.
+                for (size_t i = best + 1; i < skyline.size();) {
+                    int covered = skyline[i - 1].x + skyline[i - 1].width - skyline[i].x;
+                    if (covered <= 0) break;
+                    skyline[i].x += covered, skyline[i].width -= covered;
+                    if (skyline[i].width > 0) break;
+                    skyline.erase(skyline.begin() + i);
+                }
+                for (size_t i = 0; i + 1 < skyline.size();) {
+                    if (skyline[i].y == skyline[i + 1].y) {
+                        skyline[i].width += skyline[i + 1].width;
+                        skyline.erase(skyline.begin() + i + 1);
+                    } else i++;
+                }
+                return true;
+            }
+        };
+
+        class TextureAtlas {
+        public:
+            struct Region {
+                int page = -1;
+                ::Rectangle rec {};
+            };
+
+            struct Sprite {
+                std::string name;
+                ImageView image;
+            };
+
+        private:
+            struct Page {
+                SkylinePacker packer;
+                std::vector<Colors> pixels;
+                ::Texture2D texture {};
+                bool dirty = true;
+            };
+
+            int pageWidth, pageHeight, padding, extrude;
+            std::vector<Page> pages;
+            std::unordered_map<std::string, Region> regions;
+            size_t spriteArea = 0;
+
+            // Reserves a cell on the first page with room, adding a page if none has one.
+            bool Place(int w, int h, Region& region) {
+                int cellWidth = w + 2 * extrude + padding, cellHeight = h + 2 * extrude + padding, x = 0, y = 0;
+                size_t p = 0;
+                while (p < pages.size() && !pages[p].packer.Insert(cellWidth, cellHeight, x, y)) p++;
+                if (p == pages.size()) {
+                    // The packer is one padding larger than the page: the last column and row need no gap.
+                    Page page { SkylinePacker(pageWidth + padding, pageHeight + padding), std::vector<Colors>(size_t(pageWidth) * pageHeight, Colors(0, 0, 0, 0)) };
+                    if (!page.packer.Insert(cellWidth, cellHeight, x, y)) return false;
+                    pages.push_back(std::move(page));
+                }
+                region.page = int(p);
+                region.rec = { float(x + extrude), float(y + extrude), float(w), float(h) };
+                return true;
+            }
+
+            // Writes image into its region and repeats the edge pixels into the extrusion border. Does not
+            // mark the page dirty: batch copies run in parallel, so the callers do that serially.
+            void Copy(const Region& region, const ImageView& image) {
+                Page& page = pages[region.page];
+                int x0 = int(region.rec.x), y0 = int(region.rec.y), w = image.width, h = image.height;
+                std::vector<Colors> converted(image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 ? 0 : size_t(w));
+                auto row = [&](int y) { return page.pixels.data() + size_t(y) * pageWidth; };
+
+                for (int y = 0; y < h; y++) {
+                    const Colors* src = image.Row<Colors>(y);
+                    if (!converted.empty()) {
+                        PixelConvert::Convert(image.Row(y), image.format, converted.data(), PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, w, 1);
+                        src = converted.data();
+                    }
+                    Colors* dst = row(y0 + y) + x0;
+                    std::memcpy(dst, src, size_t(w) * sizeof(Colors));
+                    for (int e = 1; e <= extrude; e++) dst[-e] = src[0], dst[w - 1 + e] = src[w - 1];
+                }
+                size_t span = size_t(w + 2 * extrude) * sizeof(Colors);
+                for (int e = 1; e <= extrude; e++) {
+                    std::memcpy(row(y0 - e) + x0 - extrude, row(y0) + x0 - extrude, span);
+                    std::memcpy(row(y0 + h - 1 + e) + x0 - extrude, row(y0 + h - 1) + x0 - extrude, span);
+                }
+            }
+
+        public:
+            // Sprites per pool task when a batch copies its pixels.
+            static constexpr size_t parallelGrain = 16;
+
+            TextureAtlas(int pageWidth = 2048, int pageHeight = 2048, int padding = 1, int extrude = 1)
+                : pageWidth(pageWidth), pageHeight(pageHeight), padding(padding < 0 ? 0 : padding), extrude(extrude < 0 ? 0 : extrude) {}
+
+            TextureAtlas(const TextureAtlas&) = delete;
+            TextureAtlas& operator = (const TextureAtlas&) = delete;
+
+            ~TextureAtlas() {
+                for (Page& page : pages)
+                    if (page.texture.id) ::UnloadTexture(page.texture);
+            }
+
+            // Packs and copies one image. False if the name is taken, the image is empty or compressed, or it cannot fit on a page.
+            bool Add(const std::string& name, const ImageView& image) {
+                Region region;
+                if (image.Empty() || regions.count(name) || !Place(image.width, image.height, region)) return false;
+                Copy(region, image);
+                pages[region.page].dirty = true;
+                regions[name] = region;
+                spriteArea += size_t(image.width) * image.height;
+                return true;
+            }
+
+            // Packs many images, tallest first, then copies them across the pool. Returns how many were added.
+            size_t Add(const std::vector<Sprite>& sprites, ThreadPool* pool = nullptr) {
+                std::vector<size_t> order(sprites.size());
+                std::iota(order.begin(), order.end(), size_t(0));
+                std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+                    const ImageView& l = sprites[a].image, & r = sprites[b].image;
+                    return l.height != r.height ? l.height > r.height : l.width > r.width;
+                });
+
+                std::vector<std::pair<size_t, Region>> placed;
+                for (size_t i : order) {
+                    const Sprite& sprite = sprites[i];
+                    Region region;
+                    if (sprite.image.Empty() || regions.count(sprite.name) || !Place(sprite.image.width, sprite.image.height, region)) continue;
+                    regions[sprite.name] = region;
+                    spriteArea += size_t(sprite.image.width) * sprite.image.height;
+                    pages[region.page].dirty = true;
+                    placed.push_back({ i, region });
+                }
+
+                // Cells never overlap, so the copies are independent.
+                auto body = [&](size_t begin, size_t end) {
+                    for (size_t k = begin; k < end; k++) Copy(placed[k].second, sprites[placed[k].first].image);
+                };
+                if (pool && placed.size() >= 2 * parallelGrain) pool->ParallelFor(placed.size(), parallelGrain, body);
+                else body(0, placed.size());
+                return placed.size();
+            }
+
+            // The sprite's page and rectangle, or nullptr if there is no sprite with that name.
+            const Region* Find(const std::string& name) const {
+                auto it = regions.find(name);
+                return it == regions.end() ? nullptr : &it->second;
+            }
+
+            bool Contains(const std::string& name) const { return regions.count(name) != 0; }
+            size_t Count() const { return regions.size(); }
+            int Pages() const { return int(pages.size()); }
+            int PageWidth() const { return pageWidth; }
+            int PageHeight() const { return pageHeight; }
+
+            // Sprite pixels over page pixels, across all pages.
+            float Efficiency() const {
+                return pages.empty() ? 0.0f : float(double(spriteArea) / (double(pageWidth) * pageHeight * pages.size()));
+            }
+
+            // The page's pixels; valid until the next Add.
+            ImageView View(int page) {
+                return ImageView(pages[page].pixels.data(), pageWidth, pageHeight, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            }
+
+            // A copy of the page as a raylib image; free it with UnloadImage (or hand it to an Image).
+            ::Image LoadPageImage(int page) const {
+                size_t bytes = size_t(pageWidth) * pageHeight * sizeof(Colors);
+                void* data = ::MemAlloc(int(bytes));
+                std::memcpy(data, pages[page].pixels.data(), bytes);
+                return { data, pageWidth, pageHeight, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+            }
+
+            // The page's texture, uploaded first if the page changed since the last call. Render thread only.
+            ::Texture2D Texture(int page) {
+                Page& p = pages[page];
+                if (p.dirty) {
+                    ::Image image { p.pixels.data(), pageWidth, pageHeight, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+                    if (p.texture.id == 0) p.texture = ::LoadTextureFromImage(image);
+                    else ::UpdateTexture(p.texture, p.pixels.data());
+                    p.dirty = false;
+                }
+                return p.texture;
+            }
+
+            // DrawTexturePro with the sprite's page and rectangle; does nothing for an unknown name.
+            void Draw(const std::string& name, ::Rectangle dest, ::Vector2 origin = { 0.0f, 0.0f }, float rotation = 0.0f, ::Color tint = WHITE) {
+                const Region* region = Find(name);
+                if (region) ::DrawTexturePro(Texture(region->page), region->rec, dest, origin, rotation, tint);
+            }
+        };
+    }
+}
+#endif
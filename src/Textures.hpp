@@ -113,6 +113,17 @@
 #include "./RaylibExtern.hpp"
 #include "./Colors.hpp"
 #include "./Vector.hpp"
+#include "./PixelConvert.hpp"
+#include "./ImageView.hpp"
+#include "./Blitter.hpp"
+#include "./ColorLut.hpp"
+#include "./ColorPalette.hpp"
+#include "./ColorPipeline.hpp"
+#include "./Resampler.hpp"
+#include "./MipmapGenerator.hpp"
+#include "./BlockEncoder.hpp"
+#include "./ThreadPool.hpp"
+#include <cstring>
 #include <exception>
 #include <vector>
 #include <numeric>
@@ -267,12 +278,86 @@ namespace raylib {
                 return Clone(::ImageTextEx(font, text, fontSize, spacing, tint));
             }
 
-            Image& Format(int newFormat) {
+            /*
+                Uncompressed to uncompressed conversions go through PixelConvert (same bytes as
+                ImageFormat): in place when the new pixel is not larger, otherwise into one new buffer,
+                split across the pool if given. Like ImageFormat, mipmaps are regenerated afterwards.
+                Compressed formats BlockEncoder supports are encoded by Compress at Normal quality.
+            */
+            Image& Format(int newFormat, ThreadPool* pool = nullptr) {
+                if (data == nullptr || w == 0 || h == 0 || newFormat == 0 || newFormat == format) return (*this);
+                if (BlockEncoder::Supported(newFormat) && PixelConvert::Supported(format)) return Compress(newFormat, BlockQuality::Normal, pool);
+
+                if (PixelConvert::Supported(format) && PixelConvert::Supported(newFormat)) {
+                    size_t count = size_t(w) * size_t(h);
+                    int srcSize = PixelConvert::BytesPerPixel(format), dstSize = PixelConvert::BytesPerPixel(newFormat);
+
+                    if (dstSize <= srcSize && (dstSize == srcSize || pool == nullptr || count < 2 * PixelConvert::parallelGrain)) {
+                        PixelConvert::Convert(data, format, data, newFormat, w, h, pool);
+                        if (dstSize < srcSize) data = ::MemRealloc(data, static_cast<int>(count * dstSize));
+                    } else {
+                        void* converted = ::MemAlloc(static_cast<int>(count * dstSize));
+                        PixelConvert::Convert(data, format, converted, newFormat, w, h, pool);
+                        ::MemFree(data);
+                        data = converted;
+                    }
+                    format = newFormat;
+
+                    if (mipmaps > 1) {
+                        mipmaps = 1;
+                        return Mipmaps();
+                    }
+                    return (*this);
+                }
+
                 ::Image img = (*this);
                 ::ImageFormat(&img, newFormat);
                 return Clone(img);
             }
 
+            /*
+                Encodes an uncompressed image, mipmaps included, into a GPU block-compressed format with
+                BlockEncoder (DXT1/3/5, ETC1, ETC2, ETC2_EAC). Other uncompressed formats are converted to
+                RGBA8 on the way, the existing chain kept as it is. Other target formats, and images that
+                are already compressed, are left unchanged.
+
+                raylib steps through a compressed chain by GetPixelDataSize, which only matches the
+                encoded blocks while the level is made of whole 4x4 blocks (or is small enough to hit its
+                8/16 byte floor with the same size). The chain stops after the last level where the two
+                agree and mipmaps is set to match, e.g. at 4x4 for ETC1, whose floor is 16 bytes.
+            */
+            Image& Compress(int newFormat, BlockQuality quality = BlockQuality::Normal, ThreadPool* pool = nullptr) {
+                if (data == nullptr || w <= 0 || h <= 0 || newFormat == format) return (*this);
+                if (!BlockEncoder::Supported(newFormat) || !PixelConvert::Supported(format)) return (*this);
+
+                int levels = 1;
+                size_t pixels = size_t(w) * size_t(h), total = BlockEncoder::Size(w, h, newFormat);
+                bool aligned = size_t(::GetPixelDataSize(w, h, newFormat)) == total;
+                for (int lw = w, lh = h; aligned && levels < mipmaps; levels++) {
+                    lw = lw > 1 ? lw / 2 : 1, lh = lh > 1 ? lh / 2 : 1;
+                    size_t bytes = BlockEncoder::Size(lw, lh, newFormat);
+                    if (size_t(::GetPixelDataSize(lw, lh, newFormat)) != bytes) break;
+                    pixels += size_t(lw) * size_t(lh), total += bytes;
+                }
+                // A lone level 0 is still copied and uploaded at GetPixelDataSize bytes, so never allocate less.
+                size_t floor = size_t(::GetPixelDataSize(w, h, newFormat)), allocated = total > floor ? total : floor;
+
+                // Every level is a run of pixels of the same format, so the chain converts as one row.
+                std::vector<Colors> converted(format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 ? 0 : pixels);
+                if (!converted.empty()) PixelConvert::Convert(data, format, converted.data(), PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, static_cast<int>(pixels), 1);
+                uint8_t* src = converted.empty() ? static_cast<uint8_t*>(data) : reinterpret_cast<uint8_t*>(converted.data());
+
+                void* blocks = ::MemAlloc(static_cast<int>(allocated));
+                uint8_t* dst = static_cast<uint8_t*>(blocks);
+                for (int level = 0, lw = w, lh = h; level < levels; level++, lw = lw > 1 ? lw / 2 : 1, lh = lh > 1 ? lh / 2 : 1) {
+                    BlockEncoder::Encode(ImageView(src, lw, lh, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8), dst, newFormat, quality, pool);
+                    src += size_t(lw) * size_t(lh) * 4, dst += BlockEncoder::Size(lw, lh, newFormat);
+                }
+                ::MemFree(data);
+                data = blocks, format = newFormat, mipmaps = levels;
+                return (*this);
+            }
+
             Image& ToPOT(Colors fill) {
                 ::Image img = (*this);
                 ::ImageToPOT(&img, fill);
@@ -315,6 +400,31 @@ namespace raylib {
                 return Clone(img);
             }
 
+            /*
+                Separable SIMD resampling (see Resampler.hpp), split across the pool if given. RGBA8 and
+                32-bit float formats are filtered directly. Other uncompressed formats go through RGBA8
+                and back, as ImageResize does, and compressed ones fall back to ImageResize.
+            */
+            Image& Resize(int newWidth, int newHeight, ResizeFilter filter, ThreadPool* pool = nullptr) {
+                if (data == nullptr || w == 0 || h == 0 || newWidth <= 0 || newHeight <= 0) return (*this);
+                if (!Resampler::Supported(format) && !PixelConvert::Supported(format)) return Resize(newWidth, newHeight);
+
+                bool regenerate = mipmaps > 1;
+                mipmaps = 1;
+                if (!Resampler::Supported(format)) {
+                    int original = format;
+                    Format(PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, pool);
+                    Resize(newWidth, newHeight, filter, pool);
+                    Format(original, pool);
+                } else {
+                    void* resized = ::MemAlloc(static_cast<int>(size_t(newWidth) * size_t(newHeight) * PixelConvert::BytesPerPixel(format)));
+                    Resampler::Resize(data, w, h, resized, newWidth, newHeight, format, filter, pool);
+                    ::MemFree(data);
+                    data = resized, w = newWidth, h = newHeight;
+                }
+                return regenerate ? Mipmaps() : (*this);
+            }
+
             Image& ResizeNN(int newWidth, int newHeight) {
                 ::Image img = (*this);
                 ::ImageResizeNN(&img, newWidth, newHeight);
@@ -333,6 +443,39 @@ namespace raylib {
                 return Clone(img);
             }
 
+            /*
+                Regenerates the full mip chain with MipmapGenerator: one allocation, every level filtered
+                from the one above in SIMD, large levels split across the pool if given. srgb averages
+                RGBA8 colour in linear light. Other uncompressed formats are filtered in RGBA8 and the
+                chain converted back; compressed ones fall back to ImageMipmaps.
+            */
+            Image& Mipmaps(ResizeFilter filter, bool srgb = false, ThreadPool* pool = nullptr) {
+                if (data == nullptr || w <= 0 || h <= 0) return (*this);
+                if (!MipmapGenerator::Supported(format) && !PixelConvert::Supported(format)) return Mipmaps();
+
+                int levels = MipmapGenerator::Levels(w, h);
+                if (!MipmapGenerator::Supported(format)) {
+                    int original = format;
+                    mipmaps = 1;
+                    Format(PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, pool);
+                    Mipmaps(filter, srgb, pool);
+                    // Every level is a run of pixels of the same format, so the chain converts as one row.
+                    size_t count = MipmapGenerator::Size(w, h, format, levels) / PixelConvert::BytesPerPixel(format);
+                    void* converted = ::MemAlloc(static_cast<int>(count * PixelConvert::BytesPerPixel(original)));
+                    PixelConvert::Convert(data, format, converted, original, static_cast<int>(count), 1);
+                    ::MemFree(data);
+                    data = converted, format = original;
+                    return (*this);
+                }
+
+                void* chain = ::MemAlloc(static_cast<int>(MipmapGenerator::Size(w, h, format, levels)));
+                std::memcpy(chain, data, size_t(w) * size_t(h) * PixelConvert::BytesPerPixel(format));
+                MipmapGenerator::Generate(chain, w, h, format, levels, filter, srgb, pool);
+                ::MemFree(data);
+                data = chain, mipmaps = levels;
+                return (*this);
+            }
+
             Image& Dither(int rBpp, int gBpp, int bBpp, int aBpp) {
                 ::Image img = (*this);
                 ::ImageDither(&img, rBpp, gBpp, bBpp, aBpp);
@@ -381,6 +524,19 @@ namespace raylib {
                 return Clone(img);
             }
 
+            /*
+                Grades RGB through a 3D LUT in one SIMD pass (see ColorLut.hpp); alpha is unchanged.
+                Other formats go through RGBA8 and are converted back, as the ImageColor* functions do.
+            */
+            Image& ColorGrade(const ColorLut3D& lut, ThreadPool* pool = nullptr) {
+                if (data == nullptr || w == 0 || h == 0) return (*this);
+                int original = format;
+                if (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) Format(PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, pool);
+                if (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) return (*this);
+                lut.Apply(static_cast<Colors*>(data), size_t(w) * size_t(h), pool);
+                return Format(original, pool);
+            }
+
             Image& ColorContrast(float contrast) {
                 ::Image img = (*this);
                 ::ImageColorContrast(&img, contrast);
@@ -399,6 +555,31 @@ namespace raylib {
                 return Clone(img);
             }
 
+            /*
+                Records colour operations and applies them in one fused pass on Apply() (see
+                ColorPipeline.hpp): image.Pipeline(&pool).Tint(tint).Contrast(20.0f).Apply();
+            */
+            ColorPipeline Pipeline(ThreadPool* pool = nullptr) {
+                return ColorPipeline([this, pool](const ColorPipeline& pipeline) {
+                    if (data == nullptr || w == 0 || h == 0) return;
+                    int original = format;
+                    if (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) Format(PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, pool);
+                    if (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) return;
+                    pipeline.Apply(static_cast<Colors*>(data), size_t(w) * size_t(h), pool);
+                    Format(original, pool);
+                });
+            }
+
+            // Non-owning view of the pixels (see ImageView.hpp); invalidated when the buffer is reallocated.
+            ImageView View() {
+                return ImageView(PixelConvert::Supported(format) ? data : nullptr, w, h, format);
+            }
+
+            // View of rec clipped to the image, sharing its pixels.
+            ImageView View(Rectangle rec) {
+                return View().Sub(rec);
+            }
+
             Colors* LoadColors() {
                 return (Colors*) ::LoadImageColors(*this);
             }
@@ -407,6 +588,34 @@ namespace raylib {
                 return (Colors*) ::LoadImagePalette(*this, maxPaletteSize, colorsCount);
             }
 
+            /*
+                Palette of at most maxColors entries (see ColorPalette.hpp): the image's own colours
+                when there are few enough, otherwise a median-cut reduction.
+            */
+            ColorPalette BuildPalette(int maxColors = 256, ThreadPool* pool = nullptr) {
+                if (data == nullptr || w == 0 || h == 0) return ColorPalette();
+                if (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) return ColorPalette::Build(static_cast<const Colors*>(data), size_t(w) * size_t(h), maxColors, pool);
+
+                Colors* colors = LoadColors();
+                ColorPalette palette = ColorPalette::Build(colors, size_t(w) * size_t(h), maxColors, pool);
+                ::UnloadImageColors(colors);
+                return palette;
+            }
+
+            // Replaces every pixel with its palette colour; other formats go through RGBA8 and are converted back.
+            Image& Remap(const ColorPalette& palette, PaletteDither dither = PaletteDither::None, ThreadPool* pool = nullptr) {
+                if (data == nullptr || w == 0 || h == 0) return (*this);
+                int original = format;
+                if (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) Format(PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, pool);
+                if (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) return (*this);
+                palette.Apply(static_cast<Colors*>(data), w, h, dither, pool);
+                return Format(original, pool);
+            }
+
+            Image& Quantize(int maxColors, PaletteDither dither = PaletteDither::None, ThreadPool* pool = nullptr) {
+                return Remap(BuildPalette(maxColors, pool), dither, pool);
+            }
+
             Rectangle GetAlphaBorder(float threshold) {
                 return ::GetImageAlphaBorder(*this, threshold);
             }
@@ -487,6 +696,22 @@ namespace raylib {
                 return (*this);
             }
 
+            /*
+                Draw's fast path for RGBA8 images (see Blitter.hpp): SIMD, row-parallel with a pool,
+                nearest or bilinear scaling without a resized copy, optional premultiplied blending.
+                Other formats fall back to Draw (ImageDraw).
+            */
+            Image& Blit(const Image& src, Rectangle srcRec, Rectangle dstRec, Colors tint = Colors::White(), BlitFilter filter = BlitFilter::Nearest, bool premultiplied = false, ThreadPool* pool = nullptr) {
+                if (format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 || src.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+                    ::Image img = *this;
+                    ::ImageDraw(&img, ::Image{ src.data, src.w, src.h, src.mipmaps, src.format }, srcRec, dstRec, tint);
+                    return (*this);
+                }
+
+                Blitter::Blit(src.data, src.w, src.h, srcRec, data, w, h, dstRec, tint, filter, premultiplied, pool);
+                return (*this);
+            }
+
             Image& DrawText(const char* text, int posX, int posY, int fontSize, Colors color) {
                 ::Image img = *this;
                 ::ImageDrawText(&img, text, posX, posY, fontSize, color);
@@ -568,6 +793,14 @@ namespace raylib {
                 return (*this);
             }
 
+            // Builds image's mip chain on the CPU (Image::Mipmaps(filter, srgb, pool)) and reloads this texture from it.
+            Texture& GenMipmaps(Image& image, ResizeFilter filter = ResizeFilter::Box, bool srgb = false, ThreadPool* pool = nullptr) {
+                image.Mipmaps(filter, srgb, pool);
+                MemoryHandler();
+                isLoaded = true;
+                return Clone(::LoadTextureFromImage(image));
+            }
+
             Texture& SetFilter(int filter) {
                 ::SetTextureFilter(*this, filter);
                 return (*this);
@@ -0,0 +1,183 @@
+/*
+    ThreadPool: fixed set of worker threads for the batch/parallel helpers in RaylibPP.
+
+    Submit(task) queues a task and returns a std::future for its result.
+    ParallelFor(count, grain, body) splits [0, count) into chunks of `grain` indices and calls
+    body(begin, end) for each chunk. The calling thread also runs chunks, so the call returns only
+    when every chunk has finished. It never deadlocks when called from inside a worker: helpers
+    that start late find no chunks left and return.
+
+    ThreadPool::Default() is a lazily created shared pool sized to hardware_concurrency() - 1
+    workers (the caller is the extra thread).
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_THREAD_POOL
+#define RAYLIB_PLUSPLUS_THREAD_POOL
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace raylib {
+    namespace cpp {
+        class ThreadPool {
+        private:
+            std::vector<std::thread> workers;
+            std::deque<std::function<void()>> tasks;
+            std::mutex lock;
+            std::condition_variable wake;
+            bool stopping = false;
+
+            // Shared between the caller and any helper tasks of one ParallelFor call.
+            struct ParallelJob {
+                std::function<void(size_t, size_t)> body;
+                size_t count = 0, grain = 1, chunks = 0;
+                std::atomic<size_t> next { 0 }, done { 0 };
+                std::mutex lock;
+                std::condition_variable finished;
+                std::exception_ptr error;
+
+                void Run() {
+                    size_t ran = 0;
+                    for (size_t chunk; (chunk = next.fetch_add(1)) < chunks; ran++) {
+                        size_t begin = chunk * grain, end = begin + grain < count ? begin + grain : count;
+                        try {
+                            body(begin, end);
+                        } catch (...) {
+                            std::lock_guard<std::mutex> g(lock);
+                            if (!error) error = std::current_exception();
+                        }
+                    }
+
+                    if (ran > 0 && done.fetch_add(ran) + ran == chunks) {
+                        std::lock_guard<std::mutex> g(lock);
+                        finished.notify_all();
+                    }
+                }
+            };
+
+            void Work() {
+                for (;;) {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> g(lock);
+                        wake.wait(g, [this] { return stopping || !tasks.empty(); });
+                        if (stopping && tasks.empty()) return;
+                        task = std::move(tasks.front());
+                        tasks.pop_front();
+                    }
+                    task();
+                }
+            }
+
+        public:
+            // threads = number of worker threads; 0 picks hardware_concurrency() - 1.
+            explicit ThreadPool(size_t threads = 0) {
+                if (threads == 0) {
+                    unsigned hardware = std::thread::hardware_concurrency();
+                    threads = hardware > 1 ? hardware - 1 : 0;
+                }
+
+                for (size_t i = 0; i < threads; i++)
+                    workers.emplace_back([this] { Work(); });
+            }
+
+            ~ThreadPool() {
+                {
+                    std::lock_guard<std::mutex> g(lock);
+                    stopping = true;
+                }
+                wake.notify_all();
+
+                for (std::thread& worker : workers)
+                    worker.join();
+            }
+
+            ThreadPool(const ThreadPool&) = delete;
+            ThreadPool& operator = (const ThreadPool&) = delete;
+
+            static ThreadPool& Default() {
+                static ThreadPool pool;
+                return pool;
+            }
+
+            // Worker threads, not counting the thread that calls ParallelFor.
+            size_t Size() const { return workers.size(); }
+
+            template<typename F>
+            auto Submit(F&& func) -> std::future<decltype(func())> {
+                typedef decltype(func()) R;
+                std::shared_ptr<std::packaged_task<R()>> task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(func));
+                std::future<R> result = task->get_future();
+
+                if (workers.empty()) {
+                    (*task)();
+                    return result;
+                }
+
+                {
+                    std::lock_guard<std::mutex> g(lock);
+                    tasks.emplace_back([task] { (*task)(); });
+                }
+                wake.notify_one();
+                return result;
+            }
+
+            // Calls body(begin, end) over [0, count) in chunks of grain indices. Rethrows the first exception.
+            template<typename F>
+            void ParallelFor(size_t count, size_t grain, F&& body) {
+                if (grain == 0) grain = 1;
+                size_t chunks = (count + grain - 1) / grain;
+
+                if (chunks <= 1 || workers.empty()) {
+                    for (size_t begin = 0; begin < count; begin += grain)
+                        body(begin, begin + grain < count ? begin + grain : count);
+                    return;
+                }
+
+                std::shared_ptr<ParallelJob> job = std::make_shared<ParallelJob>();
+                job->body = std::ref(body);
+                job->count = count, job->grain = grain, job->chunks = chunks;
+
+                size_t helpers = chunks - 1 < workers.size() ? chunks - 1 : workers.size();
+                {
+                    std::lock_guard<std::mutex> g(lock);
+                    for (size_t i = 0; i < helpers; i++)
+                        tasks.emplace_back([job] { job->Run(); });
+                }
+                if (helpers == 1) wake.notify_one();
+                else wake.notify_all();
+
+                job->Run();
+
+                {
+                    std::unique_lock<std::mutex> g(job->lock);
+                    job->finished.wait(g, [&] { return job->done.load() == chunks; });
+                }
+
+                if (job->error)
+                    std::rethrow_exception(job->error);
+            }
+        };
+
+        // ParallelFor on ThreadPool::Default(), or serially when pool is nullptr.
+        template<typename F>
+        void ParallelFor(size_t count, size_t grain, F&& body, ThreadPool* pool = &ThreadPool::Default()) {
+            if (pool) {
+                pool->ParallelFor(count, grain, std::forward<F>(body));
+            } else {
+                if (grain == 0) grain = 1;
+                for (size_t begin = 0; begin < count; begin += grain)
+                    body(begin, begin + grain < count ? begin + grain : count);
+            }
+        }
+    }
+}
+#endif
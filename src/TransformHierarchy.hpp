@@ -0,0 +1,325 @@
+/*
+    TransformHierarchy: flat scene-graph of translation/rotation/scale nodes.
+
+    Nodes are addressed by stable Handles. Internally every per-node array (local TRS, parent
+    index, world matrix, dirty flag) is sorted by depth, so each parent precedes its children
+    and each depth level is one contiguous range:
+
+        Handle root = scene.Create();
+        Handle arm = scene.Create(root, Vector3D(0.0f, 1.0f, 0.0f));
+        scene.SetRotation(root, Quaternion::QuaternionFromAxisAngle(axis, angle));
+        scene.Update();                                 // or scene.Update(&ThreadPool::Default())
+        Matrix world = scene.GetWorldMatrix(arm);
+
+    Setters only flag the node dirty. Update() starts at the first dirty index, recomputes
+    world = local * parentWorld (MatrixMultiply order) for dirty nodes and the children of
+    recomputed nodes, and returns immediately when nothing changed, so static nodes cost
+    nothing. With a ThreadPool each depth level is split across threads.
+
+    Structural changes (Create, SetParent, Destroy) are applied lazily: the depth sort is rebuilt
+    at the next Update(). Destroy removes the node and its whole subtree at that point.
+
+    A Handle is a slot plus the slot's generation. Freed slots are reused by later Creates with a
+    new generation, so a handle kept after its node was removed stays invalid: IsValid returns
+    false, setters ignore it and getters return defaults (identity, zero, None).
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_TRANSFORM_HIERARCHY
+#define RAYLIB_PLUSPLUS_TRANSFORM_HIERARCHY
+#include "./RaylibExtern.hpp"
+#include "./Vector.hpp"
+#include "./SimdMatrix.hpp"
+#include "./ThreadPool.hpp"
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace raylib {
+    namespace cpp {
+        class TransformHierarchy {
+        public:
+            // Slot in the low 32 bits, the slot's generation in the high 32 bits.
+            typedef uint64_t Handle;
+            static constexpr Handle None = ~Handle(0);
+
+            // Minimum nodes in one depth level before Update() splits it across threads.
+            size_t parallelGrain = 1024;
+
+        private:
+            static constexpr uint32_t NoIndex = 0xFFFFFFFFu;
+
+            // Per-node arrays, indexed by sorted position.
+            std::vector<uint32_t> parents;
+            std::vector<Vector3D> translations, scales;
+            std::vector<Quaternion> rotations;
+            std::vector<Matrix> worlds;
+            std::vector<uint8_t> dirty, removed;
+            std::vector<Handle> handles;
+
+            std::vector<uint32_t> indices;      // Slot -> sorted position (NoIndex when free).
+            std::vector<uint32_t> generations;  // Slot -> generation of its current (or next) node.
+            std::vector<uint32_t> freeSlots;
+            std::vector<uint32_t> levels;       // levels[d] = first index at depth d, back() = Size().
+
+            uint32_t firstDirty = NoIndex;
+            bool structureChanged = false;
+
+            static uint32_t Slot(Handle node) { return static_cast<uint32_t>(node); }
+
+            // Sorted position of node, or NoIndex for None, unknown and stale handles.
+            uint32_t IndexOf(Handle node) const {
+                uint32_t slot = Slot(node);
+                if (slot >= indices.size() || generations[slot] != static_cast<uint32_t>(node >> 32)) return NoIndex;
+                return indices[slot];
+            }
+
+            void MarkDirty(uint32_t index) {
+                dirty[index] = 1;
+                if (index < firstDirty) firstDirty = index;
+            }
+
+            Matrix LocalMatrix(uint32_t i) const {
+                // Same as MatrixMultiply(MatrixMultiply(Scale, Rotation), Translate).
+                Matrix m = rotations[i].ToMatrix();
+                const Vector3D& s = scales[i];
+                const Vector3D& t = translations[i];
+                m.m0 *= s.x, m.m1 *= s.x, m.m2 *= s.x;
+                m.m4 *= s.y, m.m5 *= s.y, m.m6 *= s.y;
+                m.m8 *= s.z, m.m9 *= s.z, m.m10 *= s.z;
+                m.m12 = t.x, m.m13 = t.y, m.m14 = t.z;
+                return m;
+            }
+
+            void UpdateRange(uint32_t begin, uint32_t end) {
+                for (uint32_t i = begin; i < end; i++) {
+                    uint32_t parent = parents[i];
+                    bool parentChanged = parent != NoIndex && dirty[parent];
+                    if (!dirty[i] && !parentChanged) continue;
+
+                    // Children read dirty[] as "world changed this update".
+                    dirty[i] = 1;
+                    if (parent == NoIndex)
+                        worlds[i] = LocalMatrix(i);
+                    else
+                        worlds[i] = SimdMatrix::Multiply(SimdMatrix(LocalMatrix(i)), SimdMatrix(worlds[parent]));
+                }
+            }
+
+            template<typename T>
+            static void Permute(std::vector<T>& values, const std::vector<uint32_t>& order) {
+                std::vector<T> sorted(order.size());
+                for (size_t i = 0; i < order.size(); i++)
+                    sorted[i] = values[order[i]];
+                values.swap(sorted);
+            }
+
+            // Drops removed subtrees and re-sorts all arrays by depth (stable counting sort).
+            void Rebuild() {
+                uint32_t count = static_cast<uint32_t>(handles.size());
+                std::vector<uint32_t> depths(count, NoIndex), path;
+
+                for (uint32_t i = 0; i < count; i++) {
+                    uint32_t node = i;
+                    while (depths[node] == NoIndex && parents[node] != NoIndex)
+                        path.push_back(node), node = parents[node];
+                    if (depths[node] == NoIndex) depths[node] = 0;
+
+                    for (; !path.empty(); path.pop_back()) {
+                        uint32_t child = path.back();
+                        depths[child] = depths[parents[child]] + 1;
+                        removed[child] |= removed[parents[child]];
+                    }
+                }
+
+                levels.clear();
+                for (uint32_t i = 0; i < count; i++) {
+                    if (removed[i]) continue;
+                    if (depths[i] + 2 > levels.size()) levels.resize(depths[i] + 2, 0);
+                    levels[depths[i] + 1]++;
+                }
+                for (size_t d = 1; d < levels.size(); d++)
+                    levels[d] += levels[d - 1];
+                if (levels.empty()) levels.push_back(0);
+
+                std::vector<uint32_t> order(levels.back()), remap(count, NoIndex), fill(levels.begin(), levels.end());
+                for (uint32_t i = 0; i < count; i++) {
+                    if (removed[i]) {
+                        uint32_t slot = Slot(handles[i]);
+                        indices[slot] = NoIndex, generations[slot]++;
+                        freeSlots.push_back(slot);
+                        continue;
+                    }
+
+                    uint32_t position = fill[depths[i]]++;
+                    order[position] = i, remap[i] = position;
+                }
+
+                for (uint32_t& parent : parents)
+                    if (parent != NoIndex) parent = remap[parent];
+
+                Permute(parents, order), Permute(translations, order), Permute(scales, order);
+                Permute(rotations, order), Permute(worlds, order), Permute(dirty, order), Permute(handles, order);
+                removed.assign(order.size(), 0);
+
+                firstDirty = NoIndex;
+                for (uint32_t i = 0; i < order.size(); i++) {
+                    indices[Slot(handles[i])] = i;
+                    if (dirty[i] && firstDirty == NoIndex) firstDirty = i;
+                }
+
+                structureChanged = false;
+            }
+
+        public:
+            TransformHierarchy() {}
+            TransformHierarchy(size_t capacity) { Reserve(capacity); }
+
+            void Reserve(size_t capacity) {
+                parents.reserve(capacity), translations.reserve(capacity), scales.reserve(capacity);
+                rotations.reserve(capacity), worlds.reserve(capacity), dirty.reserve(capacity);
+                removed.reserve(capacity), handles.reserve(capacity), indices.reserve(capacity), generations.reserve(capacity);
+            }
+
+            // Live nodes plus nodes created or destroyed since the last Update().
+            size_t Size() const { return handles.size(); }
+
+            // False for None and for handles whose node has been removed, even if the slot was reused since.
+            bool IsValid(Handle node) const { return IndexOf(node) != NoIndex; }
+
+            Handle Create(Handle parent = None, Vector3D translation = Vector3D(0.0f, 0.0f, 0.0f),
+                Quaternion rotation = Quaternion(), Vector3D scale = Vector3D(1.0f, 1.0f, 1.0f)) {
+                uint32_t slot, parentIndex = IndexOf(parent);
+                if (!freeSlots.empty()) {
+                    slot = freeSlots.back();
+                    freeSlots.pop_back();
+                } else {
+                    slot = static_cast<uint32_t>(indices.size());
+                    indices.push_back(NoIndex), generations.push_back(0);
+                }
+                Handle node = (Handle(generations[slot]) << 32) | slot;
+
+                uint32_t index = static_cast<uint32_t>(handles.size());
+                indices[slot] = index;
+                parents.push_back(parentIndex);
+                translations.push_back(translation), rotations.push_back(rotation), scales.push_back(scale);
+                worlds.push_back(Matrix::MatrixIdentity());
+                dirty.push_back(0), removed.push_back(0), handles.push_back(node);
+
+                MarkDirty(index);
+                structureChanged = true;
+                return node;
+            }
+
+            // Removes node and all of its descendants at the next Update().
+            TransformHierarchy& Destroy(Handle node) {
+                uint32_t index = IndexOf(node);
+                if (index != NoIndex) {
+                    removed[index] = 1;
+                    structureChanged = true;
+                }
+                return (*this);
+            }
+
+            // Fails (returns false) if parent is node itself or one of its descendants.
+            bool SetParent(Handle node, Handle parent = None) {
+                uint32_t index = IndexOf(node), parentIndex = IndexOf(parent);
+                if (index == NoIndex) return false;
+
+                for (uint32_t p = parentIndex; p != NoIndex; p = parents[p])
+                    if (p == index) return false;
+
+                parents[index] = parentIndex;
+                MarkDirty(index);
+                structureChanged = true;
+                return true;
+            }
+
+            Handle GetParent(Handle node) const {
+                uint32_t index = IndexOf(node);
+                return index == NoIndex || parents[index] == NoIndex ? None : handles[parents[index]];
+            }
+
+            TransformHierarchy& SetTranslation(Handle node, Vector3D translation) {
+                uint32_t index = IndexOf(node);
+                if (index != NoIndex) translations[index] = translation, MarkDirty(index);
+                return (*this);
+            }
+
+            TransformHierarchy& SetRotation(Handle node, Quaternion rotation) {
+                uint32_t index = IndexOf(node);
+                if (index != NoIndex) rotations[index] = rotation, MarkDirty(index);
+                return (*this);
+            }
+
+            TransformHierarchy& SetScale(Handle node, Vector3D scale) {
+                uint32_t index = IndexOf(node);
+                if (index != NoIndex) scales[index] = scale, MarkDirty(index);
+                return (*this);
+            }
+
+            TransformHierarchy& SetLocal(Handle node, Vector3D translation, Quaternion rotation, Vector3D scale) {
+                uint32_t index = IndexOf(node);
+                if (index == NoIndex) return (*this);
+                translations[index] = translation, rotations[index] = rotation, scales[index] = scale;
+                MarkDirty(index);
+                return (*this);
+            }
+
+            Vector3D GetTranslation(Handle node) const {
+                uint32_t index = IndexOf(node);
+                return index == NoIndex ? Vector3D(0.0f, 0.0f, 0.0f) : translations[index];
+            }
+
+            Quaternion GetRotation(Handle node) const {
+                uint32_t index = IndexOf(node);
+                return index == NoIndex ? Quaternion() : rotations[index];
+            }
+
+            Vector3D GetScale(Handle node) const {
+                uint32_t index = IndexOf(node);
+                return index == NoIndex ? Vector3D(0.0f, 0.0f, 0.0f) : scales[index];
+            }
+
+            Matrix GetLocalMatrix(Handle node) const {
+                uint32_t index = IndexOf(node);
+                return index == NoIndex ? Matrix::MatrixIdentity() : LocalMatrix(index);
+            }
+
+            // World matrix as of the last Update(); identity for an invalid handle.
+            const Matrix& GetWorldMatrix(Handle node) const {
+                static const Matrix identity = Matrix::MatrixIdentity();
+                uint32_t index = IndexOf(node);
+                return index == NoIndex ? identity : worlds[index];
+            }
+
+            // All world matrices in sorted (parent-first) order; GetHandle(i) maps positions back to nodes.
+            const Matrix* WorldMatrices() const { return worlds.data(); }
+            Handle GetHandle(size_t position) const { return handles[position]; }
+
+            // Recomputes world matrices of dirty nodes and their descendants.
+            TransformHierarchy& Update(ThreadPool* pool = nullptr) {
+                if (structureChanged) Rebuild();
+                if (firstDirty == NoIndex) return (*this);
+
+                for (size_t d = 0; d + 1 < levels.size(); d++) {
+                    uint32_t begin = levels[d], end = levels[d + 1];
+                    if (end <= firstDirty) continue;
+                    if (begin < firstDirty) begin = firstDirty;
+
+                    if (pool && end - begin >= 2 * parallelGrain) {
+                        pool->ParallelFor(end - begin, parallelGrain, [&](size_t b, size_t e) {
+                            UpdateRange(begin + static_cast<uint32_t>(b), begin + static_cast<uint32_t>(e));
+                        });
+                    } else {
+                        UpdateRange(begin, end);
+                    }
+                }
+
+                std::memset(dirty.data() + firstDirty, 0, dirty.size() - firstDirty);
+                firstDirty = NoIndex;
+                return (*this);
+            }
+        };
+    }
+}
+#endif
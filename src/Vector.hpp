@@ -4,276 +4,421 @@
     struct Vector4;         // Vector4 type
     struct Quaternion;      // Quaternion type
     struct Matrix;          // Matrix type (OpenGL style 4x4)
-    
+
     All of raymath.h
+
+    The math is implemented inline (raymath 4.2 formulas, same operation order) instead of calling
+    the extern "C" raymath functions, so results match raymath bit for bit while the compiler is
+    free to fold constants and vectorize loops. Anything without sqrtf/trig is constexpr.
+
+    Functions with sqrt/trig take a math policy (MathPolicy.hpp) as a template parameter:
+    ExactMath by default, or FastMath for approximate rsqrt/polynomial versions.
 */
 #pragma once
 #ifndef RAYLIB_PLUSPLUS_VECTORS
 #define RAYLIB_PLUSPLUS_VECTORS
 #include "./RaylibExtern.hpp"
+#include "./MathPolicy.hpp"
+#include <cmath>
 
 namespace raylib {
     namespace cpp {
+        class Quaternion;
+        class Matrix;
+
         class RayMath {
         public:
-            static float Clamp(float value, float min, float max) {
-                return ::Clamp(value, min, max);
+            static constexpr float Clamp(float value, float min, float max) noexcept {
+                float result = (value < min) ? min : value;
+                if (result > max) result = max;
+                return result;
             }
 
-            static float Lerp(float v1, float v2, float amount) {
-                return ::Lerp(v1, v2, amount);
+            static constexpr float Lerp(float v1, float v2, float amount) noexcept {
+                return v1 + amount * (v2 - v1);
             }
 
-            static float Normalize(float value, float lo, float hi) {
-                return ::Normalize(value, lo, hi);
+            static constexpr float Normalize(float value, float lo, float hi) noexcept {
+                return (value - lo) / (hi - lo);
             }
 
-            static float Remap(float value, float inStart, float inEnd, float outStart, float outEnd) {
-                return ::Remap(value, inStart, inEnd, outStart, outEnd);
+            static constexpr float Remap(float value, float inStart, float inEnd, float outStart, float outEnd) noexcept {
+                return (value - inStart) / (inEnd - inStart) * (outEnd - outStart) + outStart;
             }
         };
 
         class Vector2D {
-        private:
-            inline Vector2D& Clone(::Vector2 v) {
-                x = v.x, y = v.y;
-                return (*this);
-            }
         public:
             float x, y;
 
-            Vector2D() { x = 0.0f, y = 0.0f; }
-            Vector2D(float x, float y) { this->x = x, this->y = y; }
-            Vector2D(::Vector2 vec) { x = vec.x, y = vec.y; }
-            operator ::Vector2() const { return { x, y }; };
+            constexpr Vector2D() noexcept : x(0.0f), y(0.0f) {}
+            constexpr Vector2D(float x, float y) noexcept : x(x), y(y) {}
+            constexpr Vector2D(::Vector2 vec) noexcept : x(vec.x), y(vec.y) {}
+            constexpr operator ::Vector2() const noexcept { return { x, y }; };
+
+            constexpr Vector2D operator + (Vector2D v) const noexcept { return Vector2D(x + v.x, y + v.y); }
+            constexpr Vector2D operator - (Vector2D v) const noexcept { return Vector2D(x - v.x, y - v.y); }
+            constexpr Vector2D operator * (Vector2D v) const noexcept { return Vector2D(x * v.x, y * v.y); }
+            constexpr Vector2D operator / (Vector2D v) const noexcept { return Vector2D(x / v.x, y / v.y); }
+            constexpr Vector2D operator * (float s) const noexcept { return Vector2D(x * s, y * s); }
+            constexpr Vector2D operator / (float s) const noexcept { return Vector2D(x / s, y / s); }
+            constexpr Vector2D operator - () const noexcept { return Vector2D(-x, -y); }
+            friend constexpr Vector2D operator * (float s, Vector2D v) noexcept { return v * s; }
+
+            constexpr Vector2D& operator += (Vector2D v) noexcept { return Add(v); }
+            constexpr Vector2D& operator -= (Vector2D v) noexcept { return Subtract(v); }
+            constexpr Vector2D& operator *= (Vector2D v) noexcept { return Multiply(v); }
+            constexpr Vector2D& operator /= (Vector2D v) noexcept { return Divide(v); }
+            constexpr Vector2D& operator *= (float s) noexcept { return Scale(s); }
+            constexpr Vector2D& operator /= (float s) noexcept { x /= s, y /= s; return (*this); }
+
+            constexpr bool operator == (Vector2D v) const noexcept { return x == v.x && y == v.y; }
+            constexpr bool operator != (Vector2D v) const noexcept { return !((*this) == v); }
+
+            static constexpr Vector2D Vector2Zero() noexcept { return Vector2D(0.0f, 0.0f); }
+            constexpr Vector2D& Zero() noexcept {
+                x = 0.0f, y = 0.0f;
+                return (*this);
+            }
 
-            static Vector2D Vector2Zero() { return ::Vector2Zero(); }
-            Vector2D& Zero() {
-                return Clone(::Vector2Zero());
+            static constexpr Vector2D Vector2One() noexcept { return Vector2D(1.0f, 1.0f); }
+            constexpr Vector2D& One() noexcept {
+                x = 1.0f, y = 1.0f;
+                return (*this);
             }
 
-            static Vector2D Vector2One() { return ::Vector2One(); }
-            Vector2D& One() {
-                return Clone(::Vector2One());
+            constexpr Vector2D& Add(Vector2D v) noexcept {
+                x = x + v.x, y = y + v.y;
+                return (*this);
             }
 
-            Vector2D& Add(Vector2D v) {
-                return Clone(::Vector2Add(*this, v));
+            constexpr Vector2D& AddValue(float value) noexcept {
+                x = x + value, y = y + value;
+                return (*this);
             }
 
-            Vector2D& AddValue(float value) {
-                return Clone(::Vector2AddValue(*this, value));
+            constexpr Vector2D& Subtract(Vector2D v) noexcept {
+                x = x - v.x, y = y - v.y;
+                return (*this);
             }
 
-            Vector2D& Subtract(Vector2D v) {
-                return Clone(::Vector2Subtract(*this, v));
+            constexpr Vector2D& SubtractValue(float value) noexcept {
+                x = x - value, y = y - value;
+                return (*this);
             }
 
-            Vector2D& SubtractValue(float value) {
-                return Clone(::Vector2SubtractValue(*this, value));
+            constexpr Vector2D& Multiply(Vector2D v) noexcept {
+                x = x * v.x, y = y * v.y;
+                return (*this);
             }
 
-            Vector2D& Multiply(Vector2D v) {
-                return Clone(::Vector2Multiply(*this, v));
+            constexpr Vector2D& Scale(float scale) noexcept {
+                x = x * scale, y = y * scale;
+                return (*this);
             }
 
-            float Length() {
-                return ::Vector2Length(*this);
+            template<typename Math = ExactMath>
+            float Length() const noexcept {
+                return Math::Sqrt((x * x) + (y * y));
             }
 
-            float LengthSqr() {
-                return ::Vector2LengthSqr(*this);
+            constexpr float LengthSqr() const noexcept {
+                return (x * x) + (y * y);
             }
 
-            float DotProduct(Vector2D v) {
-                return ::Vector2DotProduct(*this, v);
+            constexpr float DotProduct(Vector2D v) const noexcept {
+                return (x * v.x + y * v.y);
             }
 
-            float Distance(Vector2D v) {
-                return ::Vector2Distance(*this, v);
+            template<typename Math = ExactMath>
+            float Distance(Vector2D v) const noexcept {
+                return Math::Sqrt((x - v.x) * (x - v.x) + (y - v.y) * (y - v.y));
             }
 
-            float DistanceSqr(Vector2D v) {
-                return ::Vector2DistanceSqr(*this, v);
+            constexpr float DistanceSqr(Vector2D v) const noexcept {
+                return (x - v.x) * (x - v.x) + (y - v.y) * (y - v.y);
             }
 
-            float Angle(Vector2D v) {
-                return ::Vector2Angle(*this, v);
+            template<typename Math = ExactMath>
+            float Angle(Vector2D v) const noexcept {
+                return Math::Atan2(v.y - y, v.x - x);
             }
 
-            Vector2D& Negate(Vector2D v) {
-                return Clone(::Vector2Negate(*this));
+            constexpr Vector2D& Negate() noexcept {
+                x = -x, y = -y;
+                return (*this);
             }
 
-            Vector2D& Divide(Vector2D v) {
-                return Clone(::Vector2Divide(*this, v));
+            constexpr Vector2D& Negate(Vector2D v) noexcept {
+                return Negate();
             }
 
-            Vector2D& Normalize() {
-                return Clone(::Vector2Normalize(*this));
+            constexpr Vector2D& Divide(Vector2D v) noexcept {
+                x = x / v.x, y = y / v.y;
+                return (*this);
             }
 
-            Vector2D& Transform(Vector2D v) {
-                return Clone(::Vector2Normalize(*this));
+            template<typename Math = ExactMath>
+            Vector2D& Normalize() noexcept {
+                float lengthSq = (x * x) + (y * y);
+
+                if (lengthSq > 0) {
+                    float ilength = Math::InvSqrt(lengthSq);
+                    x = x * ilength, y = y * ilength;
+                } else {
+                    x = 0.0f, y = 0.0f;
+                }
+
+                return (*this);
             }
 
-            Vector2D& Lerp(Vector2D v, float amount) {
-                return Clone(::Vector2Lerp(*this, v, amount));
+            Vector2D& Transform(Matrix m) noexcept;
+
+            constexpr Vector2D& Lerp(Vector2D v, float amount) noexcept {
+                x = x + amount * (v.x - x), y = y + amount * (v.y - y);
+                return (*this);
             }
 
-            Vector2D& Reflect(Vector2D v) {
-                return Clone(::Vector2Reflect(*this, v));
+            constexpr Vector2D& Reflect(Vector2D normal) noexcept {
+                float dotProduct = (x * normal.x + y * normal.y);
+                x = x - (2.0f * normal.x) * dotProduct;
+                y = y - (2.0f * normal.y) * dotProduct;
+                return (*this);
             }
 
-            Vector2D& Rotate(float angle) {
-                return Clone(::Vector2Rotate(*this, angle));
+            template<typename Math = ExactMath>
+            Vector2D& Rotate(float angle) noexcept {
+                float cosres, sinres;
+                Math::SinCos(angle, sinres, cosres);
+                float rx = x * cosres - y * sinres, ry = x * sinres + y * cosres;
+                x = rx, y = ry;
+                return (*this);
             }
 
-            Vector2D& MoveTowards(Vector2D v, float maxDist) {
-                return Clone(::Vector2MoveTowards(*this, v, maxDist));
+            template<typename Math = ExactMath>
+            Vector2D& MoveTowards(Vector2D v, float maxDist) noexcept {
+                float dx = v.x - x, dy = v.y - y;
+                float value = (dx * dx) + (dy * dy);
+
+                if ((value == 0) || ((maxDist >= 0) && (value <= maxDist * maxDist))) {
+                    x = v.x, y = v.y;
+                    return (*this);
+                }
+
+                float dist = Math::Sqrt(value);
+                x = x + dx / dist * maxDist, y = y + dy / dist * maxDist;
+                return (*this);
             }
         };
 
         class Vector3D : public Vector2D {
-        private:
-            inline Vector3D& Clone(::Vector3 v) {
-                x = v.x, y = v.y, z = v.z;
-                return (*this);
-            }
         public:
             float z;
 
-            Vector3D() : Vector2D() { z = 0.0f; }
-            Vector3D(float x, float y, float z) : Vector2D(x, y) { this->z = z; }
-            Vector3D(::Vector3 vec) { x = vec.x, y = vec.y, z = vec.z; }
-            operator ::Vector3() const { return { x, y, z }; };
-
-            static Vector3D Vector3Zero() { return ::Vector3Zero(); }
-            Vector3D& Zero() {
-                return Clone(::Vector3Zero());
+            constexpr Vector3D() noexcept : Vector2D(), z(0.0f) {}
+            constexpr Vector3D(float x, float y, float z) noexcept : Vector2D(x, y), z(z) {}
+            constexpr Vector3D(::Vector3 vec) noexcept : Vector2D(vec.x, vec.y), z(vec.z) {}
+            constexpr operator ::Vector3() const noexcept { return { x, y, z }; };
+
+            constexpr Vector3D operator + (Vector3D v) const noexcept { return Vector3D(x + v.x, y + v.y, z + v.z); }
+            constexpr Vector3D operator - (Vector3D v) const noexcept { return Vector3D(x - v.x, y - v.y, z - v.z); }
+            constexpr Vector3D operator * (Vector3D v) const noexcept { return Vector3D(x * v.x, y * v.y, z * v.z); }
+            constexpr Vector3D operator / (Vector3D v) const noexcept { return Vector3D(x / v.x, y / v.y, z / v.z); }
+            constexpr Vector3D operator * (float s) const noexcept { return Vector3D(x * s, y * s, z * s); }
+            constexpr Vector3D operator / (float s) const noexcept { return Vector3D(x / s, y / s, z / s); }
+            constexpr Vector3D operator - () const noexcept { return Vector3D(-x, -y, -z); }
+            friend constexpr Vector3D operator * (float s, Vector3D v) noexcept { return v * s; }
+
+            constexpr Vector3D& operator += (Vector3D v) noexcept { return Add(v); }
+            constexpr Vector3D& operator -= (Vector3D v) noexcept { return Subtract(v); }
+            constexpr Vector3D& operator *= (Vector3D v) noexcept { return Multiply(v); }
+            constexpr Vector3D& operator /= (Vector3D v) noexcept { return Divide(v); }
+            constexpr Vector3D& operator *= (float s) noexcept { return Scale(s); }
+            constexpr Vector3D& operator /= (float s) noexcept { x /= s, y /= s, z /= s; return (*this); }
+
+            constexpr bool operator == (Vector3D v) const noexcept { return x == v.x && y == v.y && z == v.z; }
+            constexpr bool operator != (Vector3D v) const noexcept { return !((*this) == v); }
+
+            static constexpr Vector3D Vector3Zero() noexcept { return Vector3D(0.0f, 0.0f, 0.0f); }
+            constexpr Vector3D& Zero() noexcept {
+                x = 0.0f, y = 0.0f, z = 0.0f;
+                return (*this);
             }
 
-            static Vector3D Vector3One() { return ::Vector3One(); }
-            Vector3D& One() {
-                return Clone(::Vector3One());
+            static constexpr Vector3D Vector3One() noexcept { return Vector3D(1.0f, 1.0f, 1.0f); }
+            constexpr Vector3D& One() noexcept {
+                x = 1.0f, y = 1.0f, z = 1.0f;
+                return (*this);
             }
 
-            Vector3D& Add(Vector3D v) {
-                return Clone(::Vector3Add(*this, v));
+            constexpr Vector3D& Add(Vector3D v) noexcept {
+                x = x + v.x, y = y + v.y, z = z + v.z;
+                return (*this);
             }
 
-            Vector3D& AddValue(float value) {
-                return Clone(::Vector3AddValue(*this, value));
+            constexpr Vector3D& AddValue(float value) noexcept {
+                x = x + value, y = y + value, z = z + value;
+                return (*this);
             }
 
-            Vector3D& Subtract(Vector3D v) {
-                return Clone(::Vector3Subtract(*this, v));
+            constexpr Vector3D& Subtract(Vector3D v) noexcept {
+                x = x - v.x, y = y - v.y, z = z - v.z;
+                return (*this);
             }
 
-            Vector3D& SubtractValue(float value) {
-                return Clone(::Vector3SubtractValue(*this, value));
+            constexpr Vector3D& SubtractValue(float value) noexcept {
+                x = x - value, y = y - value, z = z - value;
+                return (*this);
             }
 
-            Vector3D& Multiply(Vector3D v) {
-                return Clone(::Vector3Multiply(*this, v));
+            constexpr Vector3D& Multiply(Vector3D v) noexcept {
+                x = x * v.x, y = y * v.y, z = z * v.z;
+                return (*this);
             }
 
-            Vector3D& CrossProduct(Vector3D v) {
-                return Clone(::Vector3CrossProduct(*this, v));
+            constexpr Vector3D& Scale(float scale) noexcept {
+                x = x * scale, y = y * scale, z = z * scale;
+                return (*this);
             }
 
-            Vector3D Perpendicular() {
-                return ::Vector3Perpendicular(*this);
+            constexpr Vector3D& CrossProduct(Vector3D v) noexcept {
+                float cx = y * v.z - z * v.y, cy = z * v.x - x * v.z, cz = x * v.y - y * v.x;
+                x = cx, y = cy, z = cz;
+                return (*this);
             }
 
-            float Length() {
-                return ::Vector3Length(*this);
-            }
+            Vector3D Perpendicular() const noexcept {
+                float min = fabsf(x);
+                Vector3D cardinalAxis(1.0f, 0.0f, 0.0f);
 
-            float LengthSqr() {
-                return ::Vector3LengthSqr(*this);
+                if (fabsf(y) < min) {
+                    min = fabsf(y);
+                    cardinalAxis = Vector3D(0.0f, 1.0f, 0.0f);
+                }
+
+                if (fabsf(z) < min)
+                    cardinalAxis = Vector3D(0.0f, 0.0f, 1.0f);
+
+                return Vector3D(*this).CrossProduct(cardinalAxis);
             }
 
-            float DotProduct(Vector3D v) {
-                return ::Vector3DotProduct(*this, v);
+            template<typename Math = ExactMath>
+            float Length() const noexcept {
+                return Math::Sqrt(x * x + y * y + z * z);
             }
 
-            float Distance(Vector3D v) {
-                return ::Vector3Distance(*this, v);
+            constexpr float LengthSqr() const noexcept {
+                return x * x + y * y + z * z;
             }
 
-            float DistanceSqr(Vector3D v) {
-                return ::Vector3DistanceSqr(*this, v);
+            constexpr float DotProduct(Vector3D v) const noexcept {
+                return (x * v.x + y * v.y + z * v.z);
             }
 
-            float Angle(Vector3D v) {
-                return ::Vector3Angle(*this, v);
+            template<typename Math = ExactMath>
+            float Distance(Vector3D v) const noexcept {
+                float dx = v.x - x, dy = v.y - y, dz = v.z - z;
+                return Math::Sqrt(dx * dx + dy * dy + dz * dz);
             }
 
-            Vector3D& Negate(Vector3D v) {
-                return Clone(::Vector3Negate(*this));
+            constexpr float DistanceSqr(Vector3D v) const noexcept {
+                float dx = v.x - x, dy = v.y - y, dz = v.z - z;
+                return dx * dx + dy * dy + dz * dz;
             }
 
-            Vector3D& Divide(Vector3D v) {
-                return Clone(::Vector3Divide(*this, v));
+            template<typename Math = ExactMath>
+            float Angle(Vector3D v) const noexcept {
+                Vector3D cross = Vector3D(*this).CrossProduct(v);
+                float len = Math::Sqrt(cross.x * cross.x + cross.y * cross.y + cross.z * cross.z);
+                float dot = (x * v.x + y * v.y + z * v.z);
+                return Math::Atan2(len, dot);
             }
 
-            Vector3D& Normalize() {
-                return Clone(::Vector3Normalize(*this));
+            constexpr Vector3D& Negate() noexcept {
+                x = -x, y = -y, z = -z;
+                return (*this);
             }
 
-            static void OrthoNormalize(Vector3D v1, Vector3D v2) {
-                ::Vector3OrthoNormalize(&static_cast<Vector3>(v1), &static_cast<Vector3>(v2));
+            constexpr Vector3D& Negate(Vector3D v) noexcept {
+                return Negate();
             }
 
-            Vector3D OrthoNormalize(Vector3D v) {
-                Vector3 v1 = *this, v2 = v;
-                ::Vector3OrthoNormalize(&v1, &v2);
-                this->Clone(v1);
-                v.Clone(v2);
+            constexpr Vector3D& Divide(Vector3D v) noexcept {
+                x = x / v.x, y = y / v.y, z = z / v.z;
+                return (*this);
             }
 
-            Vector3D& Transform(Matrix m) {
-                return Clone(::Vector3Transform(*this, m));
+            template<typename Math = ExactMath>
+            Vector3D& Normalize() noexcept {
+                float lengthSq = x * x + y * y + z * z;
+                float ilength = (lengthSq == 0.0f) ? 1.0f : Math::InvSqrt(lengthSq);
+
+                x *= ilength, y *= ilength, z *= ilength;
+                return (*this);
             }
 
-            Vector3D& RotateByQuaternion(Quaternion q) {
-                return Clone(::Vector3RotateByQuaternion(*this, q));
+            static void OrthoNormalize(Vector3D& v1, Vector3D& v2) noexcept {
+                v1.Normalize();
+                Vector3D vn1 = Vector3D(v1).CrossProduct(v2).Normalize();
+                v2 = vn1.CrossProduct(v1);
             }
 
-            Quaternion QuaternionFromVector3ToVector3(Vector3D v) {
-                return ::QuaternionFromVector3ToVector3(*this, v);
+            Vector3D& OrthoNormalize(Vector3D& v) noexcept {
+                OrthoNormalize(*this, v);
+                return (*this);
             }
 
-            Vector3D& Lerp(Vector3D v, float amount) {
-                return Clone(::Vector3Lerp(*this, v, amount));
+            Vector3D& Transform(Matrix m) noexcept;
+
+            Vector3D& RotateByQuaternion(Quaternion q) noexcept;
+
+            Quaternion QuaternionFromVector3ToVector3(Vector3D v) const noexcept;
+
+            constexpr Vector3D& Lerp(Vector3D v, float amount) noexcept {
+                x = x + amount * (v.x - x), y = y + amount * (v.y - y), z = z + amount * (v.z - z);
+                return (*this);
             }
 
-            Vector3D& Reflect(Vector3D normal) {
-                return Clone(::Vector3Reflect(*this, normal));
+            constexpr Vector3D& Reflect(Vector3D normal) noexcept {
+                float dotProduct = (x * normal.x + y * normal.y + z * normal.z);
+                x = x - (2.0f * normal.x) * dotProduct;
+                y = y - (2.0f * normal.y) * dotProduct;
+                z = z - (2.0f * normal.z) * dotProduct;
+                return (*this);
             }
 
-            Vector3D& Min(Vector3D v) {
-                return Clone(::Vector3Min(*this, v));
+            Vector3D& Min(Vector3D v) noexcept {
+                x = fminf(x, v.x), y = fminf(y, v.y), z = fminf(z, v.z);
+                return (*this);
             }
 
-            Vector3D& Max(Vector3D v) {
-                return Clone(::Vector3Max(*this, v));
+            Vector3D& Max(Vector3D v) noexcept {
+                x = fmaxf(x, v.x), y = fmaxf(y, v.y), z = fmaxf(z, v.z);
+                return (*this);
             }
 
-            static Vector3D BaryCenter(Vector3D p, Vector3D a, Vector3D b, Vector3D c) {
-                return ::Vector3Barycenter(p, a, b, c);
+            static constexpr Vector3D BaryCenter(Vector3D p, Vector3D a, Vector3D b, Vector3D c) noexcept {
+                Vector3D v0 = b - a, v1 = c - a, v2 = p - a;
+                float d00 = (v0.x * v0.x + v0.y * v0.y + v0.z * v0.z);
+                float d01 = (v0.x * v1.x + v0.y * v1.y + v0.z * v1.z);
+                float d11 = (v1.x * v1.x + v1.y * v1.y + v1.z * v1.z);
+                float d20 = (v2.x * v0.x + v2.y * v0.y + v2.z * v0.z);
+                float d21 = (v2.x * v1.x + v2.y * v1.y + v2.z * v1.z);
+
+                float denom = d00 * d11 - d01 * d01;
+
+                float ry = (d11 * d20 - d01 * d21) / denom;
+                float rz = (d00 * d21 - d01 * d20) / denom;
+                return Vector3D(1.0f - (rz + ry), ry, rz);
             }
-            Vector3D& BaryCenter(Vector3D a, Vector3D b, Vector3D c) {
-                return Clone(::Vector3Barycenter(*this, a, b, c));
+            constexpr Vector3D& BaryCenter(Vector3D a, Vector3D b, Vector3D c) noexcept {
+                return (*this) = BaryCenter(*this, a, b, c);
             }
 
-            Vector3D& Unproejct(Matrix projection, Matrix view) {
-                return Clone(::Vector3Unproject(*this, projection, view));
-            }
+            Vector3D& Unproejct(Matrix projection, Matrix view) noexcept;
 
-            float3 ToFloatV() {
-                return ::Vector3ToFloatV(*this);
+            constexpr float3 ToFloatV() const noexcept {
+                return { { x, y, z } };
             }
         };
 
@@ -281,116 +426,249 @@ namespace raylib {
         public:
             float w;
 
-            Vector4D() : Vector3D() { w = 0.0f; }
-            Vector4D(float x, float y, float z, float w) : Vector3D(x, y, z) { this->w = w; }
-            Vector4D(::Vector4 vec) { x = vec.x, y = vec.y, z = vec.z, w = vec.w; }
-            operator ::Vector4() const { return { x, y, z, w }; };
+            constexpr Vector4D() noexcept : Vector3D(), w(0.0f) {}
+            constexpr Vector4D(float x, float y, float z, float w) noexcept : Vector3D(x, y, z), w(w) {}
+            constexpr Vector4D(::Vector4 vec) noexcept : Vector3D(vec.x, vec.y, vec.z), w(vec.w) {}
+            constexpr operator ::Vector4() const noexcept { return { x, y, z, w }; };
+
+            constexpr Vector4D operator + (Vector4D v) const noexcept { return Vector4D(x + v.x, y + v.y, z + v.z, w + v.w); }
+            constexpr Vector4D operator - (Vector4D v) const noexcept { return Vector4D(x - v.x, y - v.y, z - v.z, w - v.w); }
+            constexpr Vector4D operator * (Vector4D v) const noexcept { return Vector4D(x * v.x, y * v.y, z * v.z, w * v.w); }
+            constexpr Vector4D operator / (Vector4D v) const noexcept { return Vector4D(x / v.x, y / v.y, z / v.z, w / v.w); }
+            constexpr Vector4D operator * (float s) const noexcept { return Vector4D(x * s, y * s, z * s, w * s); }
+            constexpr Vector4D operator / (float s) const noexcept { return Vector4D(x / s, y / s, z / s, w / s); }
+            constexpr Vector4D operator - () const noexcept { return Vector4D(-x, -y, -z, -w); }
+            friend constexpr Vector4D operator * (float s, Vector4D v) noexcept { return v * s; }
+
+            constexpr Vector4D& operator += (Vector4D v) noexcept { x += v.x, y += v.y, z += v.z, w += v.w; return (*this); }
+            constexpr Vector4D& operator -= (Vector4D v) noexcept { x -= v.x, y -= v.y, z -= v.z, w -= v.w; return (*this); }
+            constexpr Vector4D& operator *= (Vector4D v) noexcept { x *= v.x, y *= v.y, z *= v.z, w *= v.w; return (*this); }
+            constexpr Vector4D& operator /= (Vector4D v) noexcept { x /= v.x, y /= v.y, z /= v.z, w /= v.w; return (*this); }
+            constexpr Vector4D& operator *= (float s) noexcept { x *= s, y *= s, z *= s, w *= s; return (*this); }
+            constexpr Vector4D& operator /= (float s) noexcept { x /= s, y /= s, z /= s, w /= s; return (*this); }
+
+            constexpr bool operator == (Vector4D v) const noexcept { return x == v.x && y == v.y && z == v.z && w == v.w; }
+            constexpr bool operator != (Vector4D v) const noexcept { return !((*this) == v); }
         };
 
         class Quaternion : public Vector4D {
-        private:
-            inline Quaternion& Clone(::Quaternion q) {
-                x = q.x, y = q.y, z = q.z, w = q.w;
+        public:
+            constexpr Quaternion() noexcept : Vector4D(0.0f, 0.0f, 0.0f, 1.0f) {}
+            constexpr Quaternion(float x, float y, float z, float w) noexcept : Vector4D(x, y, z, w) {}
+            constexpr Quaternion(::Quaternion q) noexcept : Vector4D(q.x, q.y, q.z, q.w) {}
+            constexpr operator ::Quaternion() const noexcept { return { x, y, z, w }; };
+
+            constexpr Quaternion operator + (Quaternion q) const noexcept { return Quaternion(x + q.x, y + q.y, z + q.z, w + q.w); }
+            constexpr Quaternion operator - (Quaternion q) const noexcept { return Quaternion(x - q.x, y - q.y, z - q.z, w - q.w); }
+            constexpr Quaternion operator * (Quaternion q) const noexcept { return Quaternion(*this).Multiply(q); }
+            constexpr Quaternion operator / (Quaternion q) const noexcept { return Quaternion(x / q.x, y / q.y, z / q.z, w / q.w); }
+
+            constexpr Quaternion& operator += (Quaternion q) noexcept { return Add(q); }
+            constexpr Quaternion& operator -= (Quaternion q) noexcept { return Subtract(q); }
+            constexpr Quaternion& operator *= (Quaternion q) noexcept { return Multiply(q); }
+            constexpr Quaternion& operator /= (Quaternion q) noexcept { return Divide(q); }
+
+            constexpr Quaternion& Add(Quaternion q) noexcept {
+                x = x + q.x, y = y + q.y, z = z + q.z, w = w + q.w;
                 return (*this);
             }
-        public:
-            Quaternion(float x, float y, float z, float w) : Vector4D(x, y, z, w) {}
-            Quaternion(::Quaternion q) { x = q.x, y = q.y, z = q.z, w = q.w; }
-            operator ::Quaternion() const { return { x, y, z, w }; };
 
-            Quaternion& Add(Quaternion q) {
-                return Clone(::QuaternionAdd(*this, q));
+            constexpr Quaternion& AddValue(float value) noexcept {
+                x = x + value, y = y + value, z = z + value, w = w + value;
+                return (*this);
             }
 
-            Quaternion& AddValue(float value) {
-                return Clone(::QuaternionAddValue(*this, value));
+            constexpr Quaternion& Subtract(Quaternion q) noexcept {
+                x = x - q.x, y = y - q.y, z = z - q.z, w = w - q.w;
+                return (*this);
             }
 
-            Quaternion& Subtract(Quaternion q) {
-                return Clone(::QuaternionSubtract(*this, q));
+            constexpr Quaternion& SubtractValue(float value) noexcept {
+                x = x - value, y = y - value, z = z - value, w = w - value;
+                return (*this);
             }
 
-            Quaternion& SubtractValue(float value) {
-                return Clone(::QuaternionSubtractValue(*this, value));
+            static constexpr Quaternion QuaternionIdentity() noexcept { return Quaternion(0.0f, 0.0f, 0.0f, 1.0f); }
+            constexpr Quaternion& Identity() noexcept {
+                x = 0.0f, y = 0.0f, z = 0.0f, w = 1.0f;
+                return (*this);
             }
 
-            static Quaternion QuaternionIdentity() { return ::QuaternionIdentity(); }
-            Quaternion& Identity() {
-                return Clone(::QuaternionIdentity());
-            }
+            template<typename Math = ExactMath>
+            float Length() const noexcept { return Math::Sqrt(x * x + y * y + z * z + w * w); }
 
-            float Length() { return ::QuaternionLength(*this); }
+            template<typename Math = ExactMath>
+            Quaternion& Normalize() noexcept {
+                float lengthSq = x * x + y * y + z * z + w * w;
+                float ilength = (lengthSq == 0.0f) ? 1.0f : Math::InvSqrt(lengthSq);
 
-            Quaternion& Normalize() {
-                return Clone(::QuaternionNormalize(*this));
+                x = x * ilength, y = y * ilength, z = z * ilength, w = w * ilength;
+                return (*this);
             }
 
-            Quaternion& Invert() {
-                return Clone(::QuaternionInvert(*this));
-            }
+            constexpr Quaternion& Invert() noexcept {
+                float lengthSq = x * x + y * y + z * z + w * w;
 
-            Quaternion& Multiply(Quaternion q) {
-                return Clone(::QuaternionMultiply(*this, q));
+                if (lengthSq != 0.0f) {
+                    float invLength = 1.0f / lengthSq;
+                    x *= -invLength, y *= -invLength, z *= -invLength, w *= invLength;
+                }
+
+                return (*this);
             }
 
-            Quaternion& Scale(float scale) {
-                return Clone(::QuaternionScale(*this, scale));
+            constexpr Quaternion& Multiply(Quaternion q) noexcept {
+                float qax = x, qay = y, qaz = z, qaw = w;
+                float qbx = q.x, qby = q.y, qbz = q.z, qbw = q.w;
+
+                x = qax * qbw + qaw * qbx + qay * qbz - qaz * qby;
+                y = qay * qbw + qaw * qby + qaz * qbx - qax * qbz;
+                z = qaz * qbw + qaw * qbz + qax * qby - qay * qbx;
+                w = qaw * qbw - qax * qbx - qay * qby - qaz * qbz;
+                return (*this);
             }
 
-            Quaternion& Divide(Quaternion q) {
-                return Clone(::QuaternionDivide(*this, q));
+            constexpr Quaternion& Scale(float scale) noexcept {
+                x = x * scale, y = y * scale, z = z * scale, w = w * scale;
+                return (*this);
             }
 
-            Quaternion& Lerp(Quaternion q, float amount) {
-                return Clone(::QuaternionLerp(*this, q, amount));
+            constexpr Quaternion& Divide(Quaternion q) noexcept {
+                x = x / q.x, y = y / q.y, z = z / q.z, w = w / q.w;
+                return (*this);
             }
 
-            Quaternion& Slerp(Quaternion q, float amount) {
-                return Clone(::QuaternionSlerp(*this, q, amount));
+            constexpr Quaternion& Lerp(Quaternion q, float amount) noexcept {
+                x = x + amount * (q.x - x), y = y + amount * (q.y - y);
+                z = z + amount * (q.z - z), w = w + amount * (q.w - w);
+                return (*this);
             }
 
-            static Quaternion QuaternionFromVector3toVector3(Vector3D vA, Vector3D vB) { return ::QuaternionFromVector3ToVector3(vA, vB); }
-            Quaternion& FromVector3ToVector3(Vector3D vA, Vector3D vB) {
-                return Clone(::QuaternionFromVector3ToVector3(vA, vB));
+            template<typename Math = ExactMath>
+            Quaternion& Nlerp(Quaternion q, float amount) noexcept {
+                return Lerp(q, amount).Normalize<Math>();
             }
 
-            static Quaternion QuaternionFromMatrix(Matrix m) { return ::QuaternionFromMatrix(m); }
-            Quaternion& FromMatrix(Matrix m) {
-                return Clone(::QuaternionFromMatrix(m));
+            Quaternion& Slerp(Quaternion q, float amount) noexcept {
+                float cosHalfTheta = x * q.x + y * q.y + z * q.z + w * q.w;
+
+                if (cosHalfTheta < 0) {
+                    q.x = -q.x, q.y = -q.y, q.z = -q.z, q.w = -q.w;
+                    cosHalfTheta = -cosHalfTheta;
+                }
+
+                if (fabsf(cosHalfTheta) >= 1.0f)
+                    return (*this);
+
+                if (cosHalfTheta > 0.95f)
+                    return Nlerp(q, amount);
+
+                float halfTheta = acosf(cosHalfTheta);
+                float sinHalfTheta = sqrtf(1.0f - cosHalfTheta * cosHalfTheta);
+
+                if (fabsf(sinHalfTheta) < 0.001f) {
+                    x = (x * 0.5f + q.x * 0.5f), y = (y * 0.5f + q.y * 0.5f);
+                    z = (z * 0.5f + q.z * 0.5f), w = (w * 0.5f + q.w * 0.5f);
+                } else {
+                    float ratioA = sinf((1 - amount) * halfTheta) / sinHalfTheta;
+                    float ratioB = sinf(amount * halfTheta) / sinHalfTheta;
+
+                    x = (x * ratioA + q.x * ratioB), y = (y * ratioA + q.y * ratioB);
+                    z = (z * ratioA + q.z * ratioB), w = (w * ratioA + q.w * ratioB);
+                }
+
+                return (*this);
             }
 
-            Matrix ToMatrix() {
-                return ::QuaternionToMatrix(*this);
+            static Quaternion QuaternionFromVector3toVector3(Vector3D vA, Vector3D vB) noexcept { return Quaternion().FromVector3ToVector3(vA, vB); }
+            Quaternion& FromVector3ToVector3(Vector3D vA, Vector3D vB) noexcept {
+                float cos2Theta = (vA.x * vB.x + vA.y * vB.y + vA.z * vB.z);
+                Vector3D cross = Vector3D(vA).CrossProduct(vB);
+
+                x = cross.x, y = cross.y, z = cross.z, w = 1.0f + cos2Theta;
+                return Normalize();
             }
 
-            Vector4D ToAxisAngle() {
-                Vector3 v;
-                float angle;
+            static Quaternion QuaternionFromMatrix(Matrix m) noexcept;
+            Quaternion& FromMatrix(Matrix m) noexcept;
+
+            Matrix ToMatrix() const noexcept;
+
+            template<typename Math = ExactMath>
+            static Quaternion QuaternionFromAxisAngle(Vector3D axis, float angle) noexcept { return Quaternion().FromAxisAngle<Math>(axis, angle); }
+            template<typename Math = ExactMath>
+            Quaternion& FromAxisAngle(Vector3D axis, float angle) noexcept {
+                Identity();
+                float axisLength = Math::Sqrt(axis.x * axis.x + axis.y * axis.y + axis.z * axis.z);
 
-                ::QuaternionToAxisAngle(*this, &v, &angle);
-                return Vector4D(v.x, v.y, v.z, angle);
+                if (axisLength != 0.0f) {
+                    angle *= 0.5f;
+                    axis.Normalize<Math>();
+
+                    float sinres, cosres;
+                    Math::SinCos(angle, sinres, cosres);
+                    x = axis.x * sinres, y = axis.y * sinres, z = axis.z * sinres, w = cosres;
+                    Normalize<Math>();
+                }
+
+                return (*this);
             }
 
-            Quaternion& FromEuler(float pitch, float yaw, float roll) {
-                return Clone(::QuaternionFromEuler(pitch, yaw, roll));
+            Vector4D ToAxisAngle() const noexcept {
+                Quaternion q = (*this);
+                if (fabsf(q.w) > 1.0f) q.Normalize();
+
+                Vector3D resAxis(0.0f, 0.0f, 0.0f);
+                float resAngle = 2.0f * acosf(q.w);
+                float den = sqrtf(1.0f - q.w * q.w);
+
+                if (den > 0.0001f) {
+                    resAxis.x = q.x / den, resAxis.y = q.y / den, resAxis.z = q.z / den;
+                } else {
+                    resAxis.x = 1.0f;
+                }
+
+                return Vector4D(resAxis.x, resAxis.y, resAxis.z, resAngle);
             }
 
-            Vector3D ToEuler() {
-                return ::QuaternionToEuler(*this);
+            template<typename Math = ExactMath>
+            Quaternion& FromEuler(float pitch, float yaw, float roll) noexcept {
+                float x0, x1, y0, y1, z0, z1;
+                Math::SinCos(pitch * 0.5f, x1, x0);
+                Math::SinCos(yaw * 0.5f, y1, y0);
+                Math::SinCos(roll * 0.5f, z1, z0);
+
+                x = x1 * y0 * z0 - x0 * y1 * z1;
+                y = x0 * y1 * z0 + x1 * y0 * z1;
+                z = x0 * y0 * z1 - x1 * y1 * z0;
+                w = x0 * y0 * z0 + x1 * y1 * z1;
+                return (*this);
             }
 
-            Quaternion& Transform(Matrix m) {
-                return Clone(::QuaternionTransform(*this, m));
+            Vector3D ToEuler() const noexcept {
+                float x0 = 2.0f * (w * x + y * z);
+                float x1 = 1.0f - 2.0f * (x * x + y * y);
+
+                float y0 = 2.0f * (w * y - z * x);
+                y0 = y0 > 1.0f ? 1.0f : y0;
+                y0 = y0 < -1.0f ? -1.0f : y0;
+
+                float z0 = 2.0f * (w * z + x * y);
+                float z1 = 1.0f - 2.0f * (y * y + z * z);
+
+                return Vector3D(atan2f(x0, x1), asinf(y0), atan2f(z0, z1));
             }
+
+            constexpr Quaternion& Transform(Matrix m) noexcept;
         };
 
         class Matrix {
         private:
-            inline Matrix& Clone(::Matrix m) {
-                m0 = m.m0; m.m4 = m.m4; m.m8 = m8; m12 = m.m12;
-                m1 = m.m1; m.m5 = m.m5; m.m9 = m9; m13 = m.m13;
-                m2 = m.m2; m.m6 = m.m6; m.m10 = m.m10; m14 = m.m14;
-                m3 = m.m3; m.m7 = m.m7; m.m11 = m.m11; m15 = m.m15;
+            constexpr Matrix& Clone(::Matrix m) noexcept {
+                m0 = m.m0; m4 = m.m4; m8 = m.m8; m12 = m.m12;
+                m1 = m.m1; m5 = m.m5; m9 = m.m9; m13 = m.m13;
+                m2 = m.m2; m6 = m.m6; m10 = m.m10; m14 = m.m14;
+                m3 = m.m3; m7 = m.m7; m11 = m.m11; m15 = m.m15;
                 return (*this);
             }
 
@@ -400,31 +678,28 @@ namespace raylib {
             float m2, m6, m10, m14;
             float m3, m7, m11, m15;
 
-            Matrix() {
-                m0 = 0.0; m4 = 0.0; m8 = 0.0; m12 = 0.0;
-                m1 = 0.0; m5 = 0.0; m9 = 0.0; m13 = 0.0;
-                m2 = 0.0; m6 = 0.0; m10 = 0.0; m14 = 0.0;
-                m3 = 0.0; m7 = 0.0; m11 = 0.0; m15 = 0.0;
-            }
+            constexpr Matrix() noexcept :
+                m0(0.0f), m4(0.0f), m8(0.0f), m12(0.0f),
+                m1(0.0f), m5(0.0f), m9(0.0f), m13(0.0f),
+                m2(0.0f), m6(0.0f), m10(0.0f), m14(0.0f),
+                m3(0.0f), m7(0.0f), m11(0.0f), m15(0.0f) {}
 
-            Matrix(float m0 = 0.0, float m4 = 0.0, float m8 = 0.0, float m12 = 0.0,
+            constexpr Matrix(float m0, float m4 = 0.0, float m8 = 0.0, float m12 = 0.0,
             float m1 = 0.0, float m5 = 0.0, float m9 = 0.0, float m13 = 0.0,
             float m2 = 0.0, float m6 = 0.0, float m10 = 0.0, float m14 = 0.0,
-            float m3 = 0.0, float m7 = 0.0, float m11 = 0.0, float m15 = 0.0) {
-                this->m0 = m0; this->m4 = m4; this->m8 = m8; this->m12 = m12;
-                this->m1 = m1; this->m5 = m5; this->m9 = m9; this->m13 = m13;
-                this->m2 = m2; this->m6 = m6; this->m10 = m10; this->m14 = m14;
-                this->m3 = m3; this->m7 = m7; this->m11 = m11; this->m15 = m15;
-            }
-
-            Matrix(::Matrix m) {
-                m0 = m.m0; m4 = m.m4; m8 = m.m8; m12 = m.m12;
-                m1 = m.m1; m5 = m.m5; m9 = m.m9; m13 = m.m13;
-                m2 = m.m2; m6 = m.m6; m10 = m.m10; m14 = m.m14;
-                m3 = m.m3; m7 = m.m7; m11 = m.m11; m15 = m.m15;
-            }
-
-            operator ::Matrix() {
+            float m3 = 0.0, float m7 = 0.0, float m11 = 0.0, float m15 = 0.0) noexcept :
+                m0(m0), m4(m4), m8(m8), m12(m12),
+                m1(m1), m5(m5), m9(m9), m13(m13),
+                m2(m2), m6(m6), m10(m10), m14(m14),
+                m3(m3), m7(m7), m11(m11), m15(m15) {}
+
+            constexpr Matrix(::Matrix m) noexcept :
+                m0(m.m0), m4(m.m4), m8(m.m8), m12(m.m12),
+                m1(m.m1), m5(m.m5), m9(m.m9), m13(m.m13),
+                m2(m.m2), m6(m.m6), m10(m.m10), m14(m.m14),
+                m3(m.m3), m7(m.m7), m11(m.m11), m15(m.m15) {}
+
+            constexpr operator ::Matrix() const noexcept {
                 return {
                     m0, m4, m8, m12,
                     m1, m5, m9, m13,
@@ -433,103 +708,442 @@ namespace raylib {
                 };
             }
 
-            float Determinant() {
-                return ::MatrixDeterminant(*this);
+            // a * b == MatrixMultiply(a, b): transforms by a first, then by b.
+            constexpr Matrix operator * (Matrix m) const noexcept { return Matrix(*this).Multiply(m); }
+            constexpr Matrix operator + (Matrix m) const noexcept { return Matrix(*this).Add(m); }
+            constexpr Matrix operator - (Matrix m) const noexcept { return Matrix(*this).Subtract(m); }
+
+            constexpr Matrix& operator *= (Matrix m) noexcept { return Multiply(m); }
+            constexpr Matrix& operator += (Matrix m) noexcept { return Add(m); }
+            constexpr Matrix& operator -= (Matrix m) noexcept { return Subtract(m); }
+
+            constexpr float Determinant() const noexcept {
+                float a00 = m0, a01 = m1, a02 = m2, a03 = m3;
+                float a10 = m4, a11 = m5, a12 = m6, a13 = m7;
+                float a20 = m8, a21 = m9, a22 = m10, a23 = m11;
+                float a30 = m12, a31 = m13, a32 = m14, a33 = m15;
+
+                return a30*a21*a12*a03 - a20*a31*a12*a03 - a30*a11*a22*a03 + a10*a31*a22*a03 +
+                       a20*a11*a32*a03 - a10*a21*a32*a03 - a30*a21*a02*a13 + a20*a31*a02*a13 +
+                       a30*a01*a22*a13 - a00*a31*a22*a13 - a20*a01*a32*a13 + a00*a21*a32*a13 +
+                       a30*a11*a02*a23 - a10*a31*a02*a23 - a30*a01*a12*a23 + a00*a31*a12*a23 +
+                       a10*a01*a32*a23 - a00*a11*a32*a23 - a20*a11*a02*a33 + a10*a21*a02*a33 +
+                       a20*a01*a12*a33 - a00*a21*a12*a33 - a10*a01*a22*a33 + a00*a11*a22*a33;
+            }
+
+            constexpr float Trace() const noexcept {
+                return (m0 + m5 + m10 + m15);
+            }
+
+            constexpr Matrix& Transpose() noexcept {
+                return (*this) = Matrix(
+                    m0, m1, m2, m3,
+                    m4, m5, m6, m7,
+                    m8, m9, m10, m11,
+                    m12, m13, m14, m15);
+            }
+
+            constexpr Matrix& Invert() noexcept {
+                float a00 = m0, a01 = m1, a02 = m2, a03 = m3;
+                float a10 = m4, a11 = m5, a12 = m6, a13 = m7;
+                float a20 = m8, a21 = m9, a22 = m10, a23 = m11;
+                float a30 = m12, a31 = m13, a32 = m14, a33 = m15;
+
+                float b00 = a00*a11 - a01*a10;
+                float b01 = a00*a12 - a02*a10;
+                float b02 = a00*a13 - a03*a10;
+                float b03 = a01*a12 - a02*a11;
+                float b04 = a01*a13 - a03*a11;
+                float b05 = a02*a13 - a03*a12;
+                float b06 = a20*a31 - a21*a30;
+                float b07 = a20*a32 - a22*a30;
+                float b08 = a20*a33 - a23*a30;
+                float b09 = a21*a32 - a22*a31;
+                float b10 = a21*a33 - a23*a31;
+                float b11 = a22*a33 - a23*a32;
+
+                float invDet = 1.0f/(b00*b11 - b01*b10 + b02*b09 + b03*b08 - b04*b07 + b05*b06);
+
+                m0 = (a11*b11 - a12*b10 + a13*b09)*invDet;
+                m1 = (-a01*b11 + a02*b10 - a03*b09)*invDet;
+                m2 = (a31*b05 - a32*b04 + a33*b03)*invDet;
+                m3 = (-a21*b05 + a22*b04 - a23*b03)*invDet;
+                m4 = (-a10*b11 + a12*b08 - a13*b07)*invDet;
+                m5 = (a00*b11 - a02*b08 + a03*b07)*invDet;
+                m6 = (-a30*b05 + a32*b02 - a33*b01)*invDet;
+                m7 = (a20*b05 - a22*b02 + a23*b01)*invDet;
+                m8 = (a10*b10 - a11*b08 + a13*b06)*invDet;
+                m9 = (-a00*b10 + a01*b08 - a03*b06)*invDet;
+                m10 = (a30*b04 - a31*b02 + a33*b00)*invDet;
+                m11 = (-a20*b04 + a21*b02 - a23*b00)*invDet;
+                m12 = (-a10*b09 + a11*b07 - a12*b06)*invDet;
+                m13 = (a00*b09 - a01*b07 + a02*b06)*invDet;
+                m14 = (-a30*b03 + a31*b01 - a32*b00)*invDet;
+                m15 = (a20*b03 - a21*b01 + a22*b00)*invDet;
+                return (*this);
             }
 
-            float Trace() {
-                return ::MatrixTrace(*this);
-            }
+            constexpr Matrix& Normalize() noexcept {
+                float det = Determinant();
 
-            Matrix& Transpose() {
-                return Clone(::MatrixTranspose(*this));
+                m0 /= det; m4 /= det; m8 /= det; m12 /= det;
+                m1 /= det; m5 /= det; m9 /= det; m13 /= det;
+                m2 /= det; m6 /= det; m10 /= det; m14 /= det;
+                m3 /= det; m7 /= det; m11 /= det; m15 /= det;
+                return (*this);
             }
 
-            Matrix& Invert() {
-                return Clone(::MatrixInvert(*this));
+            static constexpr Matrix MatrixIdentity() noexcept {
+                return Matrix(
+                    1.0f, 0.0f, 0.0f, 0.0f,
+                    0.0f, 1.0f, 0.0f, 0.0f,
+                    0.0f, 0.0f, 1.0f, 0.0f,
+                    0.0f, 0.0f, 0.0f, 1.0f);
             }
-
-            Matrix& Normalize() {
-                return Clone(::MatrixNormalize(*this));
+            constexpr Matrix& Identity() noexcept {
+                return (*this) = MatrixIdentity();
             }
 
-            static Matrix MatrixIdentity() { return ::MatrixIdentity(); }
-            Matrix& Identity() {
-                return Clone(::MatrixIdentity());
+            constexpr Matrix& Add(Matrix m) noexcept {
+                m0 += m.m0; m4 += m.m4; m8 += m.m8; m12 += m.m12;
+                m1 += m.m1; m5 += m.m5; m9 += m.m9; m13 += m.m13;
+                m2 += m.m2; m6 += m.m6; m10 += m.m10; m14 += m.m14;
+                m3 += m.m3; m7 += m.m7; m11 += m.m11; m15 += m.m15;
+                return (*this);
             }
 
-            Matrix& Subtract(Matrix m) {
-                return Clone(::MatrixSubtract(*this, m));
+            constexpr Matrix& Subtract(Matrix m) noexcept {
+                m0 -= m.m0; m4 -= m.m4; m8 -= m.m8; m12 -= m.m12;
+                m1 -= m.m1; m5 -= m.m5; m9 -= m.m9; m13 -= m.m13;
+                m2 -= m.m2; m6 -= m.m6; m10 -= m.m10; m14 -= m.m14;
+                m3 -= m.m3; m7 -= m.m7; m11 -= m.m11; m15 -= m.m15;
+                return (*this);
             }
 
-            Matrix& Multiply(Matrix m) {
-                return Clone(::MatrixMultiply(*this, m));
+            constexpr Matrix& Multiply(Matrix right) noexcept {
+                Matrix left = (*this);
+
+                m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8 + left.m3*right.m12;
+                m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9 + left.m3*right.m13;
+                m2 = left.m0*right.m2 + left.m1*right.m6 + left.m2*right.m10 + left.m3*right.m14;
+                m3 = left.m0*right.m3 + left.m1*right.m7 + left.m2*right.m11 + left.m3*right.m15;
+                m4 = left.m4*right.m0 + left.m5*right.m4 + left.m6*right.m8 + left.m7*right.m12;
+                m5 = left.m4*right.m1 + left.m5*right.m5 + left.m6*right.m9 + left.m7*right.m13;
+                m6 = left.m4*right.m2 + left.m5*right.m6 + left.m6*right.m10 + left.m7*right.m14;
+                m7 = left.m4*right.m3 + left.m5*right.m7 + left.m6*right.m11 + left.m7*right.m15;
+                m8 = left.m8*right.m0 + left.m9*right.m4 + left.m10*right.m8 + left.m11*right.m12;
+                m9 = left.m8*right.m1 + left.m9*right.m5 + left.m10*right.m9 + left.m11*right.m13;
+                m10 = left.m8*right.m2 + left.m9*right.m6 + left.m10*right.m10 + left.m11*right.m14;
+                m11 = left.m8*right.m3 + left.m9*right.m7 + left.m10*right.m11 + left.m11*right.m15;
+                m12 = left.m12*right.m0 + left.m13*right.m4 + left.m14*right.m8 + left.m15*right.m12;
+                m13 = left.m12*right.m1 + left.m13*right.m5 + left.m14*right.m9 + left.m15*right.m13;
+                m14 = left.m12*right.m2 + left.m13*right.m6 + left.m14*right.m10 + left.m15*right.m14;
+                m15 = left.m12*right.m3 + left.m13*right.m7 + left.m14*right.m11 + left.m15*right.m15;
+                return (*this);
             }
 
-            static Matrix Translate(Vector3D v) { return ::MatrixTranslate(v.x, v.y, v.z); }
-            static Matrix Translate(float x, float y, float z) {
-                return ::MatrixTranslate(x, y, z);
+            static constexpr Matrix Translate(Vector3D v) noexcept { return Translate(v.x, v.y, v.z); }
+            static constexpr Matrix Translate(float x, float y, float z) noexcept {
+                return Matrix(
+                    1.0f, 0.0f, 0.0f, x,
+                    0.0f, 1.0f, 0.0f, y,
+                    0.0f, 0.0f, 1.0f, z,
+                    0.0f, 0.0f, 0.0f, 1.0f);
             }
 
-            static Matrix Rotate(Vector4D v) { return ::MatrixRotate(v, v.w); }
-            static Matrix Rotate(Vector3D v, float angle) {
-                return ::MatrixRotate(v, angle);
-            }
+            static Matrix Rotate(Vector4D v) noexcept { return Rotate(v, v.w); }
+            static Matrix Rotate(Vector3D v, float angle) noexcept {
+                float x = v.x, y = v.y, z = v.z;
+                float lengthSquared = x * x + y * y + z * z;
 
-            static Matrix RotateX(float angle) {
-                return ::MatrixRotateX(angle);
-            }
-            
-            static Matrix RotateY(float angle) {
-                return ::MatrixRotateY(angle);
+                if ((lengthSquared != 1.0f) && (lengthSquared != 0.0f)) {
+                    float ilength = 1.0f / sqrtf(lengthSquared);
+                    x *= ilength, y *= ilength, z *= ilength;
+                }
+
+                float sinres = sinf(angle), cosres = cosf(angle);
+                float t = 1.0f - cosres;
+
+                Matrix result;
+                result.m0 = x*x*t + cosres;
+                result.m1 = y*x*t + z*sinres;
+                result.m2 = z*x*t - y*sinres;
+                result.m3 = 0.0f;
+
+                result.m4 = x*y*t - z*sinres;
+                result.m5 = y*y*t + cosres;
+                result.m6 = z*y*t + x*sinres;
+                result.m7 = 0.0f;
+
+                result.m8 = x*z*t + y*sinres;
+                result.m9 = y*z*t - x*sinres;
+                result.m10 = z*z*t + cosres;
+                result.m11 = 0.0f;
+
+                result.m12 = 0.0f, result.m13 = 0.0f, result.m14 = 0.0f, result.m15 = 1.0f;
+                return result;
             }
 
-            static Matrix RotateZ(float angle) {
-                return ::MatrixRotateY(angle);
+            static Matrix RotateX(float angle) noexcept {
+                Matrix result = MatrixIdentity();
+                float cosres = cosf(angle), sinres = sinf(angle);
+
+                result.m5 = cosres, result.m6 = sinres;
+                result.m9 = -sinres, result.m10 = cosres;
+                return result;
             }
 
-            static Matrix RotateXYZ(Vector3D angle) {
-                return ::MatrixRotateXYZ(angle);
+            static Matrix RotateY(float angle) noexcept {
+                Matrix result = MatrixIdentity();
+                float cosres = cosf(angle), sinres = sinf(angle);
+
+                result.m0 = cosres, result.m2 = -sinres;
+                result.m8 = sinres, result.m10 = cosres;
+                return result;
             }
 
-            static Matrix RotateZYX(Vector3D angle) {
-                return ::MatrixRotateZYX(angle);
+            static Matrix RotateZ(float angle) noexcept {
+                Matrix result = MatrixIdentity();
+                float cosres = cosf(angle), sinres = sinf(angle);
+
+                result.m0 = cosres, result.m1 = sinres;
+                result.m4 = -sinres, result.m5 = cosres;
+                return result;
             }
 
-            static Matrix Scale(Vector3D v) { return ::MatrixScale(v.x, v.y, v.z); }
-            static Matrix Scale(float x, float y, float z) {
-                return ::MatrixScale(x, y, z);
+            static Matrix RotateXYZ(Vector3D angle) noexcept {
+                Matrix result = MatrixIdentity();
+
+                float cosz = cosf(-angle.z), sinz = sinf(-angle.z);
+                float cosy = cosf(-angle.y), siny = sinf(-angle.y);
+                float cosx = cosf(-angle.x), sinx = sinf(-angle.x);
+
+                result.m0 = cosz*cosy;
+                result.m4 = (cosz*siny*sinx) - (sinz*cosx);
+                result.m8 = (cosz*siny*cosx) + (sinz*sinx);
+
+                result.m1 = sinz*cosy;
+                result.m5 = (sinz*siny*sinx) + (cosz*cosx);
+                result.m9 = (sinz*siny*cosx) - (cosz*sinx);
+
+                result.m2 = -siny;
+                result.m6 = cosy*sinx;
+                result.m10 = cosy*cosx;
+                return result;
             }
 
-            static Matrix Frustum(double left, double right, double bottom, double top, double near, double far) {
-                return ::MatrixFrustum(left, right, bottom, top, near, far);
+            static Matrix RotateZYX(Vector3D angle) noexcept {
+                Matrix result;
+
+                float cz = cosf(angle.z), sz = sinf(angle.z);
+                float cy = cosf(angle.y), sy = sinf(angle.y);
+                float cx = cosf(angle.x), sx = sinf(angle.x);
+
+                result.m0 = cz*cy;
+                result.m1 = cy*sz;
+                result.m2 = -sy;
+                result.m3 = 0.0f;
+
+                result.m4 = cz*sy*sx - cx*sz;
+                result.m5 = cz*cx + sz*sy*sx;
+                result.m6 = cy*sx;
+                result.m7 = 0.0f;
+
+                result.m8 = sz*sx + cz*cx*sy;
+                result.m9 = cx*sz*sy - cz*sx;
+                result.m10 = cy*cx;
+                result.m11 = 0.0f;
+
+                result.m12 = 0.0f, result.m13 = 0.0f, result.m14 = 0.0f, result.m15 = 1.0f;
+                return result;
             }
 
-            static Matrix Perspective(double fovy, double aspect, double near, double far) {
-                return ::MatrixPerspective(fovy, aspect, near, far);
+            static constexpr Matrix Scale(Vector3D v) noexcept { return Scale(v.x, v.y, v.z); }
+            static constexpr Matrix Scale(float x, float y, float z) noexcept {
+                return Matrix(
+                    x, 0.0f, 0.0f, 0.0f,
+                    0.0f, y, 0.0f, 0.0f,
+                    0.0f, 0.0f, z, 0.0f,
+                    0.0f, 0.0f, 0.0f, 1.0f);
             }
 
-            static Matrix OrthoProjection(double left, double right, double bottom, double top, double near, double far) {
-                return ::MatrixOrtho(left, right, bottom, top, near, far);
+            static constexpr Matrix Frustum(double left, double right, double bottom, double top, double near, double far) noexcept {
+                float rl = (float)(right - left);
+                float tb = (float)(top - bottom);
+                float fn = (float)(far - near);
+
+                Matrix result;
+                result.m0 = ((float)near * 2.0f) / rl;
+                result.m5 = ((float)near * 2.0f) / tb;
+                result.m8 = ((float)right + (float)left) / rl;
+                result.m9 = ((float)top + (float)bottom) / tb;
+                result.m10 = -((float)far + (float)near) / fn;
+                result.m11 = -1.0f;
+                result.m14 = -((float)far * (float)near * 2.0f) / fn;
+                return result;
             }
 
-            static Matrix LookAt(Vector3D eye, Vector3D target, Vector3D up) {
-                return ::MatrixLookAt(eye, target, up);
+            static Matrix Perspective(double fovy, double aspect, double near, double far) noexcept {
+                double top = near * tan(fovy * 0.5);
+                double right = top * aspect;
+                return Frustum(-right, right, -top, top, near, far);
             }
 
-            float16 ToFloatV() {
-                return ::MatrixToFloatV(*this);
+            static constexpr Matrix OrthoProjection(double left, double right, double bottom, double top, double near, double far) noexcept {
+                float rl = (float)(right - left);
+                float tb = (float)(top - bottom);
+                float fn = (float)(far - near);
+
+                Matrix result;
+                result.m0 = 2.0f / rl;
+                result.m5 = 2.0f / tb;
+                result.m10 = -2.0f / fn;
+                result.m12 = -((float)left + (float)right) / rl;
+                result.m13 = -((float)top + (float)bottom) / tb;
+                result.m14 = -((float)far + (float)near) / fn;
+                result.m15 = 1.0f;
+                return result;
             }
 
-            static Matrix MatrixFromQuaternion(Quaternion q) { return ::QuaternionToMatrix(q); }
-            inline Matrix& FromQuaternion(Quaternion q) {
-                return Clone(::QuaternionToMatrix(q));
+            static Matrix LookAt(Vector3D eye, Vector3D target, Vector3D up) noexcept {
+                Vector3D vz = (eye - target).Normalize();
+                Vector3D vx = Vector3D(up).CrossProduct(vz).Normalize();
+                Vector3D vy = Vector3D(vz).CrossProduct(vx);
+
+                return Matrix(
+                    vx.x, vx.y, vx.z, -(vx.x * eye.x + vx.y * eye.y + vx.z * eye.z),
+                    vy.x, vy.y, vy.z, -(vy.x * eye.x + vy.y * eye.y + vy.z * eye.z),
+                    vz.x, vz.y, vz.z, -(vz.x * eye.x + vz.y * eye.y + vz.z * eye.z),
+                    0.0f, 0.0f, 0.0f, 1.0f);
+            }
+
+            constexpr float16 ToFloatV() const noexcept {
+                return { { m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15 } };
+            }
+
+            static constexpr Matrix MatrixFromQuaternion(Quaternion q) noexcept { return Matrix().FromQuaternion(q); }
+            constexpr Matrix& FromQuaternion(Quaternion q) noexcept {
+                float a2 = q.x * q.x, b2 = q.y * q.y, c2 = q.z * q.z;
+                float ac = q.x * q.z, ab = q.x * q.y, bc = q.y * q.z;
+                float ad = q.w * q.x, bd = q.w * q.y, cd = q.w * q.z;
+
+                Identity();
+                m0 = 1 - 2 * (b2 + c2), m1 = 2 * (ab + cd), m2 = 2 * (ac - bd);
+                m4 = 2 * (ab - cd), m5 = 1 - 2 * (a2 + c2), m6 = 2 * (bc + ad);
+                m8 = 2 * (ac + bd), m9 = 2 * (bc - ad), m10 = 1 - 2 * (a2 + b2);
+                return (*this);
             }
 
-            Quaternion ToQuaternion() {
-                return ::QuaternionFromMatrix(*this);
+            Quaternion ToQuaternion() const noexcept {
+                return Quaternion().FromMatrix(*this);
             }
         };
+
+        inline Vector2D& Vector2D::Transform(Matrix m) noexcept {
+            float z = 0.0f;
+            float rx = m.m0 * x + m.m4 * y + m.m8 * z + m.m12;
+            float ry = m.m1 * x + m.m5 * y + m.m9 * z + m.m13;
+            x = rx, y = ry;
+            return (*this);
+        }
+
+        inline Vector3D& Vector3D::Transform(Matrix m) noexcept {
+            float rx = m.m0 * x + m.m4 * y + m.m8 * z + m.m12;
+            float ry = m.m1 * x + m.m5 * y + m.m9 * z + m.m13;
+            float rz = m.m2 * x + m.m6 * y + m.m10 * z + m.m14;
+            x = rx, y = ry, z = rz;
+            return (*this);
+        }
+
+        inline Vector3D& Vector3D::RotateByQuaternion(Quaternion q) noexcept {
+            Vector3D v = (*this);
+            x = v.x*(q.x*q.x + q.w*q.w - q.y*q.y - q.z*q.z) + v.y*(2*q.x*q.y - 2*q.w*q.z) + v.z*(2*q.x*q.z + 2*q.w*q.y);
+            y = v.x*(2*q.w*q.z + 2*q.x*q.y) + v.y*(q.w*q.w - q.x*q.x + q.y*q.y - q.z*q.z) + v.z*(-2*q.w*q.x + 2*q.y*q.z);
+            z = v.x*(-2*q.w*q.y + 2*q.x*q.z) + v.y*(2*q.w*q.x + 2*q.y*q.z) + v.z*(q.w*q.w - q.x*q.x - q.y*q.y + q.z*q.z);
+            return (*this);
+        }
+
+        inline Quaternion Vector3D::QuaternionFromVector3ToVector3(Vector3D v) const noexcept {
+            return Quaternion().FromVector3ToVector3(*this, v);
+        }
+
+        inline Vector3D& Vector3D::Unproejct(Matrix projection, Matrix view) noexcept {
+            Matrix matViewProjInv = (view * projection).Invert();
+            Quaternion q = Quaternion(x, y, z, 1.0f).Transform(matViewProjInv);
+
+            x = q.x / q.w, y = q.y / q.w, z = q.z / q.w;
+            return (*this);
+        }
+
+        inline Quaternion Quaternion::QuaternionFromMatrix(Matrix m) noexcept { return Quaternion().FromMatrix(m); }
+        inline Quaternion& Quaternion::FromMatrix(Matrix mat) noexcept {
+            float fourWSquaredMinus1 = mat.m0 + mat.m5 + mat.m10;
+            float fourXSquaredMinus1 = mat.m0 - mat.m5 - mat.m10;
+            float fourYSquaredMinus1 = mat.m5 - mat.m0 - mat.m10;
+            float fourZSquaredMinus1 = mat.m10 - mat.m0 - mat.m5;
+
+            int biggestIndex = 0;
+            float fourBiggestSquaredMinus1 = fourWSquaredMinus1;
+            if (fourXSquaredMinus1 > fourBiggestSquaredMinus1) {
+                fourBiggestSquaredMinus1 = fourXSquaredMinus1;
+                biggestIndex = 1;
+            }
+
+            if (fourYSquaredMinus1 > fourBiggestSquaredMinus1) {
+                fourBiggestSquaredMinus1 = fourYSquaredMinus1;
+                biggestIndex = 2;
+            }
+
+            if (fourZSquaredMinus1 > fourBiggestSquaredMinus1) {
+                fourBiggestSquaredMinus1 = fourZSquaredMinus1;
+                biggestIndex = 3;
+            }
+
+            float biggestVal = sqrtf(fourBiggestSquaredMinus1 + 1.0f) * 0.5f;
+            float mult = 0.25f / biggestVal;
+
+            switch (biggestIndex) {
+                case 0:
+                    w = biggestVal;
+                    x = (mat.m6 - mat.m9) * mult;
+                    y = (mat.m8 - mat.m2) * mult;
+                    z = (mat.m1 - mat.m4) * mult;
+                    break;
+                case 1:
+                    x = biggestVal;
+                    w = (mat.m6 - mat.m9) * mult;
+                    y = (mat.m1 + mat.m4) * mult;
+                    z = (mat.m8 + mat.m2) * mult;
+                    break;
+                case 2:
+                    y = biggestVal;
+                    w = (mat.m8 - mat.m2) * mult;
+                    x = (mat.m1 + mat.m4) * mult;
+                    z = (mat.m6 + mat.m9) * mult;
+                    break;
+                case 3:
+                    z = biggestVal;
+                    w = (mat.m1 - mat.m4) * mult;
+                    x = (mat.m8 + mat.m2) * mult;
+                    y = (mat.m6 + mat.m9) * mult;
+                    break;
+            }
+
+            return (*this);
+        }
+
+        inline Matrix Quaternion::ToMatrix() const noexcept {
+            return Matrix().FromQuaternion(*this);
+        }
+
+        inline constexpr Quaternion& Quaternion::Transform(Matrix mat) noexcept {
+            float qx = x, qy = y, qz = z, qw = w;
+            x = mat.m0 * qx + mat.m4 * qy + mat.m8 * qz + mat.m12 * qw;
+            y = mat.m1 * qx + mat.m5 * qy + mat.m9 * qz + mat.m13 * qw;
+            z = mat.m2 * qx + mat.m6 * qy + mat.m10 * qz + mat.m14 * qw;
+            w = mat.m3 * qx + mat.m7 * qy + mat.m11 * qz + mat.m15 * qw;
+            return (*this);
+        }
     }
 }
 #endif
@@ -0,0 +1,237 @@
+/*
+    Structure-of-arrays containers for bulk Vector2/Vector3 math.
+
+    Vector2Array & Vector3Array keep each component in its own contiguous float array so the
+    batch functions can run through simd::Batch (see Simd.hpp). Every batch function applies the
+    same formula as its single-value raymath counterpart in the same operation order
+    (Normalize takes a MathPolicy.hpp policy, FastMath trades exactness for an rsqrt estimate):
+
+        Vector2Array::Transform             -> Vector2Transform
+        Vector2Array::Rotate                -> Vector2Rotate
+        Vector2Array::Lerp                  -> Vector2Lerp
+        Vector2Array::Normalize             -> Vector2Normalize
+        Vector2Array::Distance              -> Vector2Distance
+        Vector3Array::Transform             -> Vector3Transform
+        Vector3Array::RotateByQuaternion    -> Vector3RotateByQuaternion
+        Vector3Array::Lerp                  -> Vector3Lerp
+        Vector3Array::Normalize             -> Vector3Normalize
+        Vector3Array::Distance              -> Vector3Distance
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_VECTOR_ARRAY
+#define RAYLIB_PLUSPLUS_VECTOR_ARRAY
+#include "./RaylibExtern.hpp"
+#include "./Vector.hpp"
+#include "./Simd.hpp"
+#include <vector>
+
+namespace raylib {
+    namespace cpp {
+        class Vector2Array {
+        public:
+            std::vector<float> x, y;
+
+            Vector2Array() {}
+            Vector2Array(size_t count) : x(count), y(count) {}
+            Vector2Array(const Vector2D* points, size_t count) : x(count), y(count) {
+                for (size_t i = 0; i < count; i++)
+                    x[i] = points[i].x, y[i] = points[i].y;
+            }
+
+            size_t Size() const { return x.size(); }
+            void Resize(size_t count) { x.resize(count), y.resize(count); }
+            void Reserve(size_t count) { x.reserve(count), y.reserve(count); }
+            void Clear() { x.clear(), y.clear(); }
+
+            void Push(Vector2D v) { x.push_back(v.x), y.push_back(v.y); }
+            Vector2D Get(size_t i) const { return Vector2D(x[i], y[i]); }
+            void Set(size_t i, Vector2D v) { x[i] = v.x, y[i] = v.y; }
+
+            void ToVectors(Vector2D* out) const {
+                for (size_t i = 0; i < Size(); i++)
+                    out[i] = Vector2D(x[i], y[i]);
+            }
+
+            Vector2Array& Transform(Matrix m) {
+                float* px = x.data(), * py = y.data();
+                simd::Batch(Size(), [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F vx = simd::Load<F>(px + i), vy = simd::Load<F>(py + i);
+                    simd::Store(F(m.m0) * vx + F(m.m4) * vy + F(m.m12), px + i);
+                    simd::Store(F(m.m1) * vx + F(m.m5) * vy + F(m.m13), py + i);
+                });
+                return (*this);
+            }
+
+            Vector2Array& Rotate(float angle) {
+                float* px = x.data(), * py = y.data();
+                float cosres = cosf(angle), sinres = sinf(angle);
+                simd::Batch(Size(), [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F vx = simd::Load<F>(px + i), vy = simd::Load<F>(py + i);
+                    simd::Store(vx * F(cosres) - vy * F(sinres), px + i);
+                    simd::Store(vx * F(sinres) + vy * F(cosres), py + i);
+                });
+                return (*this);
+            }
+
+            Vector2Array& Lerp(const Vector2Array& v, float amount) {
+                float* px = x.data(), * py = y.data();
+                const float* qx = v.x.data(), * qy = v.y.data();
+                simd::Batch(Size(), [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F vx = simd::Load<F>(px + i), vy = simd::Load<F>(py + i);
+                    simd::Store(vx + F(amount) * (simd::Load<F>(qx + i) - vx), px + i);
+                    simd::Store(vy + F(amount) * (simd::Load<F>(qy + i) - vy), py + i);
+                });
+                return (*this);
+            }
+
+            template<typename Math = ExactMath>
+            Vector2Array& Normalize() {
+                float* px = x.data(), * py = y.data();
+                simd::Batch(Size(), [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F vx = simd::Load<F>(px + i), vy = simd::Load<F>(py + i);
+                    F lengthSq = (vx * vx) + (vy * vy);
+                    auto valid = lengthSq > F(0.0f);
+                    F ilength = Math::InvSqrt(lengthSq);
+                    simd::Store(simd::Select(valid, vx * ilength, F(0.0f)), px + i);
+                    simd::Store(simd::Select(valid, vy * ilength, F(0.0f)), py + i);
+                });
+                return (*this);
+            }
+
+            // Writes Size() distances between matching elements of this and v into out.
+            void Distance(const Vector2Array& v, float* out) const {
+                const float* px = x.data(), * py = y.data();
+                const float* qx = v.x.data(), * qy = v.y.data();
+                simd::Batch(Size(), [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F dx = simd::Load<F>(px + i) - simd::Load<F>(qx + i);
+                    F dy = simd::Load<F>(py + i) - simd::Load<F>(qy + i);
+                    simd::Store(simd::Sqrt(dx * dx + dy * dy), out + i);
+                });
+            }
+
+            void Distance(Vector2D v, float* out) const {
+                const float* px = x.data(), * py = y.data();
+                simd::Batch(Size(), [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F dx = simd::Load<F>(px + i) - F(v.x);
+                    F dy = simd::Load<F>(py + i) - F(v.y);
+                    simd::Store(simd::Sqrt(dx * dx + dy * dy), out + i);
+                });
+            }
+        };
+
+        class Vector3Array {
+        public:
+            std::vector<float> x, y, z;
+
+            Vector3Array() {}
+            Vector3Array(size_t count) : x(count), y(count), z(count) {}
+            Vector3Array(const Vector3D* points, size_t count) : x(count), y(count), z(count) {
+                for (size_t i = 0; i < count; i++)
+                    x[i] = points[i].x, y[i] = points[i].y, z[i] = points[i].z;
+            }
+
+            size_t Size() const { return x.size(); }
+            void Resize(size_t count) { x.resize(count), y.resize(count), z.resize(count); }
+            void Reserve(size_t count) { x.reserve(count), y.reserve(count), z.reserve(count); }
+            void Clear() { x.clear(), y.clear(), z.clear(); }
+
+            void Push(Vector3D v) { x.push_back(v.x), y.push_back(v.y), z.push_back(v.z); }
+            Vector3D Get(size_t i) const { return Vector3D(x[i], y[i], z[i]); }
+            void Set(size_t i, Vector3D v) { x[i] = v.x, y[i] = v.y, z[i] = v.z; }
+
+            void ToVectors(Vector3D* out) const {
+                for (size_t i = 0; i < Size(); i++)
+                    out[i] = Vector3D(x[i], y[i], z[i]);
+            }
+
+            Vector3Array& Transform(Matrix m) {
+                float* px = x.data(), * py = y.data(), * pz = z.data();
+                simd::Batch(Size(), [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F vx = simd::Load<F>(px + i), vy = simd::Load<F>(py + i), vz = simd::Load<F>(pz + i);
+                    simd::Store(F(m.m0) * vx + F(m.m4) * vy + F(m.m8) * vz + F(m.m12), px + i);
+                    simd::Store(F(m.m1) * vx + F(m.m5) * vy + F(m.m9) * vz + F(m.m13), py + i);
+                    simd::Store(F(m.m2) * vx + F(m.m6) * vy + F(m.m10) * vz + F(m.m14), pz + i);
+                });
+                return (*this);
+            }
+
+            Vector3Array& RotateByQuaternion(Quaternion q) {
+                float* px = x.data(), * py = y.data(), * pz = z.data();
+
+                // Rotation coefficients are constant across the batch, compute them once.
+                const float c00 = q.x*q.x + q.w*q.w - q.y*q.y - q.z*q.z, c01 = 2*q.x*q.y - 2*q.w*q.z, c02 = 2*q.x*q.z + 2*q.w*q.y;
+                const float c10 = 2*q.w*q.z + 2*q.x*q.y, c11 = q.w*q.w - q.x*q.x + q.y*q.y - q.z*q.z, c12 = -2*q.w*q.x + 2*q.y*q.z;
+                const float c20 = -2*q.w*q.y + 2*q.x*q.z, c21 = 2*q.w*q.x + 2*q.y*q.z, c22 = q.w*q.w - q.x*q.x - q.y*q.y + q.z*q.z;
+
+                simd::Batch(Size(), [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F vx = simd::Load<F>(px + i), vy = simd::Load<F>(py + i), vz = simd::Load<F>(pz + i);
+                    simd::Store(vx * F(c00) + vy * F(c01) + vz * F(c02), px + i);
+                    simd::Store(vx * F(c10) + vy * F(c11) + vz * F(c12), py + i);
+                    simd::Store(vx * F(c20) + vy * F(c21) + vz * F(c22), pz + i);
+                });
+                return (*this);
+            }
+
+            Vector3Array& Lerp(const Vector3Array& v, float amount) {
+                float* px = x.data(), * py = y.data(), * pz = z.data();
+                const float* qx = v.x.data(), * qy = v.y.data(), * qz = v.z.data();
+                simd::Batch(Size(), [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F vx = simd::Load<F>(px + i), vy = simd::Load<F>(py + i), vz = simd::Load<F>(pz + i);
+                    simd::Store(vx + F(amount) * (simd::Load<F>(qx + i) - vx), px + i);
+                    simd::Store(vy + F(amount) * (simd::Load<F>(qy + i) - vy), py + i);
+                    simd::Store(vz + F(amount) * (simd::Load<F>(qz + i) - vz), pz + i);
+                });
+                return (*this);
+            }
+
+            template<typename Math = ExactMath>
+            Vector3Array& Normalize() {
+                float* px = x.data(), * py = y.data(), * pz = z.data();
+                simd::Batch(Size(), [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F vx = simd::Load<F>(px + i), vy = simd::Load<F>(py + i), vz = simd::Load<F>(pz + i);
+                    F lengthSq = vx * vx + vy * vy + vz * vz;
+                    F ilength = simd::Select(lengthSq == F(0.0f), F(1.0f), Math::InvSqrt(lengthSq));
+                    simd::Store(vx * ilength, px + i);
+                    simd::Store(vy * ilength, py + i);
+                    simd::Store(vz * ilength, pz + i);
+                });
+                return (*this);
+            }
+
+            // Writes Size() distances between matching elements of this and v into out.
+            void Distance(const Vector3Array& v, float* out) const {
+                const float* px = x.data(), * py = y.data(), * pz = z.data();
+                const float* qx = v.x.data(), * qy = v.y.data(), * qz = v.z.data();
+                simd::Batch(Size(), [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F dx = simd::Load<F>(qx + i) - simd::Load<F>(px + i);
+                    F dy = simd::Load<F>(qy + i) - simd::Load<F>(py + i);
+                    F dz = simd::Load<F>(qz + i) - simd::Load<F>(pz + i);
+                    simd::Store(simd::Sqrt(dx * dx + dy * dy + dz * dz), out + i);
+                });
+            }
+
+            void Distance(Vector3D v, float* out) const {
+                const float* px = x.data(), * py = y.data(), * pz = z.data();
+                simd::Batch(Size(), [&](size_t i, auto lane) {
+                    using F = decltype(lane);
+                    F dx = F(v.x) - simd::Load<F>(px + i);
+                    F dy = F(v.y) - simd::Load<F>(py + i);
+                    F dz = F(v.z) - simd::Load<F>(pz + i);
+                    simd::Store(simd::Sqrt(dx * dx + dy * dy + dz * dz), out + i);
+                });
+            }
+        };
+    }
+}
+#endif
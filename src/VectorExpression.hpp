@@ -0,0 +1,173 @@
+/*
+    Expression templates over Vector2D / Vector3D / Vector4D.
+
+    Lazy(v) wraps a vector (or Lazy(ptr) / Lazy(std::vector) wraps an array of vectors) so that
+    chained math records a tree of nodes instead of computing a temporary per step:
+
+        Vector3D dir = Lazy(v).Add(a).Multiply(b).Normalize();               // one fused evaluation
+        (Lazy(positions) + Lazy(velocities) * dt).EvalTo(positions.data(), n);  // one pass, no temporaries
+
+    Every node implements At(i), the value of the expression for element i. Single values ignore i,
+    array references return ptr[i], so singles and arrays mix freely (a single value broadcasts).
+    EvalTo(out, count) writes At(i) for each i; each element only reads index i of its inputs, so
+    out may alias any input array.
+
+    Node evaluation uses the inline Vector.hpp math, giving the same results as the eager methods.
+*/
+#pragma once
+#ifndef RAYLIB_PLUSPLUS_VECTOR_EXPRESSION
+#define RAYLIB_PLUSPLUS_VECTOR_EXPRESSION
+#include "./Vector.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace raylib {
+    namespace cpp {
+        template<typename L, typename R, typename Op> class VectorBinaryExpression;
+        template<typename L, typename Op> class VectorUnaryExpression;
+        template<typename V> class VectorValue;
+
+        namespace expression {
+            inline Vector2D Normalize(Vector2D v) noexcept { return v.Normalize(); }
+            inline Vector3D Normalize(Vector3D v) noexcept { return v.Normalize(); }
+            inline Vector4D Normalize(Vector4D v) noexcept {
+                float length = sqrtf(v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w);
+                if (length == 0.0f) length = 1.0f;
+                float ilength = 1.0f / length;
+                return v * ilength;
+            }
+
+            struct Add { template<typename V> V operator () (const V& a, const V& b) const noexcept { return a + b; } };
+            struct Subtract { template<typename V> V operator () (const V& a, const V& b) const noexcept { return a - b; } };
+            struct Multiply { template<typename V> V operator () (const V& a, const V& b) const noexcept { return a * b; } };
+            struct Divide { template<typename V> V operator () (const V& a, const V& b) const noexcept { return a / b; } };
+            struct Negate { template<typename V> V operator () (const V& a) const noexcept { return -a; } };
+            struct Normal { template<typename V> V operator () (const V& a) const noexcept { return Normalize(a); } };
+
+            struct Scale {
+                float s;
+                template<typename V> V operator () (const V& a) const noexcept { return a * s; }
+            };
+
+            struct Lerp {
+                float amount;
+                template<typename V> V operator () (const V& a, const V& b) const noexcept { return a + (b - a) * amount; }
+            };
+        }
+
+        template<typename E, typename V>
+        class VectorExpression {
+        public:
+            typedef V Value;
+
+            const E& Self() const noexcept { return static_cast<const E&>(*this); }
+
+            V Eval(size_t i = 0) const noexcept { return Self().At(i); }
+            operator V() const noexcept { return Self().At(0); }
+
+            void EvalTo(V* out, size_t count) const noexcept {
+                const E& self = Self();
+                for (size_t i = 0; i < count; i++)
+                    out[i] = self.At(i);
+            }
+
+            void EvalTo(std::vector<V>& out) const noexcept { EvalTo(out.data(), out.size()); }
+
+            template<typename R>
+            VectorBinaryExpression<E, R, expression::Add> Add(const VectorExpression<R, V>& r) const noexcept { return { Self(), r.Self() }; }
+            VectorBinaryExpression<E, VectorValue<V>, expression::Add> Add(const V& r) const noexcept { return { Self(), r }; }
+
+            template<typename R>
+            VectorBinaryExpression<E, R, expression::Subtract> Subtract(const VectorExpression<R, V>& r) const noexcept { return { Self(), r.Self() }; }
+            VectorBinaryExpression<E, VectorValue<V>, expression::Subtract> Subtract(const V& r) const noexcept { return { Self(), r }; }
+
+            template<typename R>
+            VectorBinaryExpression<E, R, expression::Multiply> Multiply(const VectorExpression<R, V>& r) const noexcept { return { Self(), r.Self() }; }
+            VectorBinaryExpression<E, VectorValue<V>, expression::Multiply> Multiply(const V& r) const noexcept { return { Self(), r }; }
+
+            template<typename R>
+            VectorBinaryExpression<E, R, expression::Divide> Divide(const VectorExpression<R, V>& r) const noexcept { return { Self(), r.Self() }; }
+            VectorBinaryExpression<E, VectorValue<V>, expression::Divide> Divide(const V& r) const noexcept { return { Self(), r }; }
+
+            template<typename R>
+            VectorBinaryExpression<E, R, expression::Lerp> Lerp(const VectorExpression<R, V>& r, float amount) const noexcept { return { Self(), r.Self(), { amount } }; }
+            VectorBinaryExpression<E, VectorValue<V>, expression::Lerp> Lerp(const V& r, float amount) const noexcept { return { Self(), r, { amount } }; }
+
+            VectorUnaryExpression<E, expression::Scale> Scale(float s) const noexcept { return { Self(), { s } }; }
+            VectorUnaryExpression<E, expression::Negate> Negate() const noexcept { return { Self() }; }
+            VectorUnaryExpression<E, expression::Normal> Normalize() const noexcept { return { Self() }; }
+        };
+
+        // Leaf: one vector, broadcast to every index.
+        template<typename V>
+        class VectorValue : public VectorExpression<VectorValue<V>, V> {
+        public:
+            V value;
+
+            VectorValue(const V& value) noexcept : value(value) {}
+            const V& At(size_t) const noexcept { return value; }
+        };
+
+        // Leaf: non-owning reference to an array of vectors.
+        template<typename V>
+        class VectorArrayReference : public VectorExpression<VectorArrayReference<V>, V> {
+        public:
+            const V* data;
+
+            VectorArrayReference(const V* data) noexcept : data(data) {}
+            const V& At(size_t i) const noexcept { return data[i]; }
+        };
+
+        template<typename L, typename R, typename Op>
+        class VectorBinaryExpression : public VectorExpression<VectorBinaryExpression<L, R, Op>, typename L::Value> {
+        public:
+            L left;
+            R right;
+            Op op;
+
+            VectorBinaryExpression(const L& left, const R& right, Op op = Op()) noexcept : left(left), right(right), op(op) {}
+            typename L::Value At(size_t i) const noexcept { return op(left.At(i), right.At(i)); }
+        };
+
+        template<typename L, typename Op>
+        class VectorUnaryExpression : public VectorExpression<VectorUnaryExpression<L, Op>, typename L::Value> {
+        public:
+            L operand;
+            Op op;
+
+            VectorUnaryExpression(const L& operand, Op op = Op()) noexcept : operand(operand), op(op) {}
+            typename L::Value At(size_t i) const noexcept { return op(operand.At(i)); }
+        };
+
+        template<typename V> VectorValue<V> Lazy(const V& v) noexcept { return VectorValue<V>(v); }
+        template<typename V> VectorArrayReference<V> Lazy(const V* data) noexcept { return VectorArrayReference<V>(data); }
+        template<typename V> VectorArrayReference<V> Lazy(V* data) noexcept { return VectorArrayReference<V>(data); }
+        template<typename V> VectorArrayReference<V> Lazy(const std::vector<V>& data) noexcept { return VectorArrayReference<V>(data.data()); }
+
+        template<typename L, typename R, typename V>
+        VectorBinaryExpression<L, R, expression::Add> operator + (const VectorExpression<L, V>& l, const VectorExpression<R, V>& r) noexcept { return l.Add(r); }
+        template<typename L, typename R, typename V>
+        VectorBinaryExpression<L, R, expression::Subtract> operator - (const VectorExpression<L, V>& l, const VectorExpression<R, V>& r) noexcept { return l.Subtract(r); }
+        template<typename L, typename R, typename V>
+        VectorBinaryExpression<L, R, expression::Multiply> operator * (const VectorExpression<L, V>& l, const VectorExpression<R, V>& r) noexcept { return l.Multiply(r); }
+        template<typename L, typename R, typename V>
+        VectorBinaryExpression<L, R, expression::Divide> operator / (const VectorExpression<L, V>& l, const VectorExpression<R, V>& r) noexcept { return l.Divide(r); }
+
+        template<typename L, typename V>
+        VectorBinaryExpression<L, VectorValue<V>, expression::Add> operator + (const VectorExpression<L, V>& l, const typename VectorExpression<L, V>::Value& r) noexcept { return l.Add(r); }
+        template<typename L, typename V>
+        VectorBinaryExpression<L, VectorValue<V>, expression::Subtract> operator - (const VectorExpression<L, V>& l, const typename VectorExpression<L, V>::Value& r) noexcept { return l.Subtract(r); }
+        template<typename L, typename V>
+        VectorBinaryExpression<L, VectorValue<V>, expression::Multiply> operator * (const VectorExpression<L, V>& l, const typename VectorExpression<L, V>::Value& r) noexcept { return l.Multiply(r); }
+        template<typename L, typename V>
+        VectorBinaryExpression<L, VectorValue<V>, expression::Divide> operator / (const VectorExpression<L, V>& l, const typename VectorExpression<L, V>::Value& r) noexcept { return l.Divide(r); }
+
+        template<typename L, typename V>
+        VectorUnaryExpression<L, expression::Scale> operator * (const VectorExpression<L, V>& l, float s) noexcept { return l.Scale(s); }
+        template<typename L, typename V>
+        VectorUnaryExpression<L, expression::Scale> operator * (float s, const VectorExpression<L, V>& l) noexcept { return l.Scale(s); }
+        template<typename L, typename V>
+        VectorUnaryExpression<L, expression::Negate> operator - (const VectorExpression<L, V>& l) noexcept { return l.Negate(); }
+    }
+}
+#endif